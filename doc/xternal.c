@@ -498,6 +498,7 @@
  *          <li>\ref reader_mps.h "MPS"</li>
  *          <li>\ref reader_lp.h "LP"</li>
  *          <li>\ref reader_zpl.h "ZPL"</li>
+ *          <li>\ref reader_snp.h "SNP" (binary snapshots)</li>
  *       </ul>
  *    </td>
  *    <td>
@@ -7795,6 +7796,16 @@
  * problem that is currently read is too large \SCIP will automatically use fewer threads, but never
  * go below the configured minimum number of threads.
  *
+ * @section PARALLELMODE Deterministic and opportunistic mode
+ *
+ * The parameter <code>parallel/mode</code> selects how the concurrent solvers synchronize. In deterministic mode (the
+ * default), solvers do not synchronize on wall-clock time but on a deterministic time that is accumulated from
+ * LP iterations (including strong branching), probing bound changes, and the number of checks of the limits, each weighted
+ * by the number of nonzeros of the problem. Solutions and bound changes are only read from a synchronization once all
+ * solvers have written to it. Hence, two runs with the same settings and seeds produce the same result, independent of
+ * thread scheduling. The opportunistic mode synchronizes based on wall-clock time, which usually exchanges
+ * information earlier but is not reproducible.
+ *
  * @section USEEMPHSETTINGS Using emphasis settings
  *
  * The parameters <code>concurrent/scip.../prefprio</code> configure which concurrent solvers should be used.
@@ -7806,6 +7817,16 @@
  * solvers will use 2 threads. If the <code>prefprio</code> for one solver is set to 0.33 and the other is set to 1.0, then the former will use 1 thread
  * and the latter will use 3 threads of the 4 available threads.
  *
+ * @section HEURCONCSOLVERS Using additional threads for primal heuristics
+ *
+ * Primal heuristics that solve sub-MIPs, e.g., ALNS, RINS, or crossover, are always executed by the thread that
+ * processes the branch-and-bound tree, since their sub-SCIPs are created from and write back into the data of this
+ * \SCIP instance. To spend additional cores on finding solutions without slowing down the tree search, the concurrent
+ * solver <code>scip-feas</code>, which loads the feasibility emphasis with aggressive primal heuristics, can be combined
+ * with the concurrent solver <code>scip</code>, e.g., by setting <code>concurrent/scip/prefprio = 1.0</code> and
+ * <code>concurrent/scip-feas/prefprio = 0.5</code>. In opportunistic mode (<code>parallel/mode = 0</code>), a new best
+ * solution of any concurrent solver is passed to the other solvers at their next node.
+ *
  * @section CUSTOMCONCSOLVERS Running custom solvers
  *
  * To use custom settings for the concurrent solvers there is the parameter <code>concurrent/paramsetprefix</code>. If custom parameters
@@ -7813,6 +7834,17 @@
  * The parameter settings must be named after the concurrent solvers, e.g. if only the concurrent solver <code>scip</code> is used
  * they should be named <code>scip-1</code>, <code>scip-2</code>, <code>scip-3</code>. When different types of concurrent solvers are used the counter
  * starts at one for each of them, e.g. <code>scip-1</code> and <code>scip-feas-1</code>.
+ *
+ * @section PARALLELTREESEARCH Parallel tree search
+ *
+ * The concurrent solving mode races complete copies of the problem and does not distribute the branch-and-bound
+ * tree of a single \SCIP instance over several threads. Open nodes, the LP, and the warm start information stored
+ * in the tree are owned by one \SCIP instance and are not thread-safe, so work stealing between threads inside one
+ * instance is not supported. Since the concurrent solvers differ only by their settings and random seeds, the
+ * speedup of the concurrent mode typically saturates after a few threads. If many cores should be used for
+ * the tree search itself, the UG framework (see <a href="https://ug.zib.de">https://ug.zib.de</a>) should be used
+ * instead. It runs \SCIP as base solver in a supervisor-worker scheme, where subtrees are transferred between
+ * independent \SCIP instances and incumbents and global bounds are shared among all of them.
  */
 
 /*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
@@ -10265,6 +10297,7 @@
  * <tr><td>\ref reader_opb.h "OPB format"</td> <td>for pseudo-Boolean optimization instances</td></tr>
  * <tr><td>\ref reader_osil.h "OSiL format"</td> <td>for mixed-integer nonlinear programs</td></tr>
  * <tr><td>\ref reader_pip.h "PIP format"</td> <td>for <a href="http://polip.zib.de/pipformat.php">mixed-integer polynomial programming problems</a></td></tr>
+ * <tr><td>\ref reader_snp.h "SNP format"</td> <td>for binary snapshots of mixed-integer linear programs, e.g., of presolved problems</td></tr>
  * <tr><td>\ref reader_sol.h "SOL format"</td> <td>for solutions; XML-format (read-only) or raw SCIP format</td></tr>
  * <tr><td>\ref reader_wbo.h "WBO format"</td> <td>for weighted pseudo-Boolean optimization instances</td></tr>
  * <tr><td>\ref reader_zpl.h "ZPL format"</td> <td>for <a href="http://zimpl.zib.de">ZIMPL</a> models, i.e., mixed-integer linear and nonlinear
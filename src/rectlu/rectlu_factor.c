@@ -1190,9 +1190,27 @@ static void qsnum_find_pivot_column(
    int bestnz = -1;
    int i;
    int r;
+   *p_r = -1;
+
+   /* with a zero threshold, every entry passes the threshold test, such that the pivot row is determined by the
+    * sparsity pattern alone and no rational arithmetic is needed
+    */
+   if( !QSnum_NeqZero (f->partial_cur) )
+   {
+      for( i = 0; i < nzcnt; i++ )
+      {
+         r = ucindx[cbeg + i];
+         if( bestnz == -1 || ur_inf[r].pivcnt < bestnz )
+         {
+            bestnz = ur_inf[r].pivcnt;
+            *p_r = r;
+         }
+      }
+      return;
+   }
+
    QSnum_Init (num_tmp[0]);
    QSnum_Init (num_tmp[1]);
-   *p_r = -1;
    for( i = 0; i < nzcnt; i++ )
    {
       r = ucindx[cbeg + i];
@@ -1231,12 +1249,30 @@ static void qsnum_find_pivot_row(
    int bestnz = -1;
    int i = 0;
    int c;
+   *p_c = -1;
+
+   /* with a zero threshold, every entry passes the threshold test, such that the pivot column is determined by the
+    * sparsity pattern alone and no rational arithmetic is needed
+    */
+   if( !QSnum_NeqZero (f->partial_cur) )
+   {
+      for( i = 0; i < pivcnt; i++ )
+      {
+         c = urindx[rbeg + i];
+         if( bestnz == -1 || uc_inf[c].nzcnt < bestnz )
+         {
+            bestnz = uc_inf[c].nzcnt;
+            *p_c = c;
+         }
+      }
+      return;
+   }
+
    QSnum_Init (thresh[0]);
    QSnum_Init (thresh[1]);
    QSnum_Copy (thresh[0], f->partial_cur);
    QSnum_CopyMult (thresh[0], ur_inf[r].max);
    QSnum_CopyAbs (thresh[1], urcoef[rbeg + i]);
-   *p_c = -1;
    for( i = 0; i < pivcnt; i++ )
    {
       c = urindx[rbeg + i];
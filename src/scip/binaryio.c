@@ -0,0 +1,163 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   binaryio.c
+ * @ingroup OTHER_CFILES
+ * @brief  methods for reading and writing the binary files of SCIP, such as snapshots and cached presolved problems
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <string.h>
+
+#include "scip/binaryio.h"
+#include "blockmemshell/memory.h"
+
+#define BINARYIO_CHUNKSIZE     1073741824   /**< maximal number of bytes that are read at once */
+
+/** number of bytes that are needed to fill up nbytes to a multiple of 8 bytes */
+#define BINARYIO_PADDING(nbytes) ((8 - ((nbytes) % 8)) % 8)
+
+
+/** initializes the leading part of the header of a binary file written on this machine */
+void SCIPbinaryInitHeader(
+   SCIP_BINARYHEADER*    header,             /**< header to initialize */
+   const char*           magic,              /**< magic string of the file type, at most 7 characters */
+   int                   version             /**< version of the file format */
+   )
+{
+   assert(header != NULL);
+   assert(magic != NULL);
+   assert(strlen(magic) < sizeof(header->magic));
+
+   BMSclearMemory(header);
+   BMScopyMemoryArray(header->magic, magic, strlen(magic) + 1);
+   header->version = version;
+   header->byteorder = SCIP_BINARYIO_BYTEORDER;
+}
+
+/** checks the leading part of the header of a binary file that was read from disk */
+SCIP_BINARYSTATUS SCIPbinaryCheckHeader(
+   const SCIP_BINARYHEADER* header,          /**< header to check */
+   const char*           magic,              /**< expected magic string of the file type */
+   int                   version             /**< expected version of the file format */
+   )
+{
+   assert(header != NULL);
+   assert(magic != NULL);
+
+   if( strncmp(header->magic, magic, sizeof(header->magic)) != 0 )
+      return SCIP_BINARYSTATUS_WRONGTYPE;
+   if( header->byteorder == SCIP_BINARYIO_BYTEORDERSWAPPED )
+      return SCIP_BINARYSTATUS_SWAPPED;
+   if( header->byteorder != SCIP_BINARYIO_BYTEORDER )
+      return SCIP_BINARYSTATUS_CORRUPTED;
+   if( header->version != version )
+      return SCIP_BINARYSTATUS_VERSION;
+
+   return SCIP_BINARYSTATUS_OK;
+}
+
+/** reads an array and the padding behind it; returns whether the read was successful */
+SCIP_Bool SCIPbinaryReadArray(
+   SCIP_FILE*            fp,                 /**< file to read from */
+   void*                 data,               /**< array to store the data */
+   size_t                size,               /**< size of an element in bytes */
+   size_t                n                   /**< number of elements */
+   )
+{
+   char padding[8];
+   size_t nbytes;
+   size_t npadding;
+   size_t pos;
+
+   assert(fp != NULL);
+   assert(data != NULL || n == 0);
+
+   /* SCIPfread() is called with element size 1, because with zlib it returns the number of bytes read; large arrays
+    * are read in chunks, because zlib reads at most UINT_MAX bytes at once
+    */
+   nbytes = size * n;
+   for( pos = 0; pos < nbytes; pos += BINARYIO_CHUNKSIZE )
+   {
+      size_t nchunkbytes = MIN(nbytes - pos, (size_t)BINARYIO_CHUNKSIZE);
+
+      if( SCIPfread((char*)data + pos, 1, nchunkbytes, fp) != nchunkbytes )
+         return FALSE;
+   }
+
+   npadding = BINARYIO_PADDING(nbytes);
+
+   return npadding == 0 || SCIPfread(padding, 1, npadding, fp) == npadding;
+}
+
+/** writes an array and fills up the file to a multiple of 8 bytes; returns whether the write was successful */
+SCIP_Bool SCIPbinaryWriteArray(
+   FILE*                 file,               /**< file to write to */
+   const void*           data,               /**< array to write */
+   size_t                size,               /**< size of an element in bytes */
+   size_t                n                   /**< number of elements */
+   )
+{
+   assert(file != NULL);
+   assert(data != NULL || n == 0);
+
+   if( n > 0 && fwrite(data, size, n, file) != n )
+      return FALSE;
+
+   return SCIPbinaryWritePadding(file, size * n);
+}
+
+/** writes a null-terminated string without padding; returns whether the write was successful */
+SCIP_Bool SCIPbinaryWriteString(
+   FILE*                 file,               /**< file to write to */
+   const char*           str                 /**< string to write */
+   )
+{
+   size_t len;
+
+   assert(file != NULL);
+   assert(str != NULL);
+
+   len = strlen(str) + 1;
+
+   return fwrite(str, 1, len, file) == len;
+}
+
+/** fills up the file to a multiple of 8 bytes after data of the given size; returns whether the write was successful */
+SCIP_Bool SCIPbinaryWritePadding(
+   FILE*                 file,               /**< file to write to */
+   size_t                nbytes              /**< size of the written data in bytes */
+   )
+{
+   static const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+   size_t npadding;
+
+   assert(file != NULL);
+
+   npadding = BINARYIO_PADDING(nbytes);
+
+   return npadding == 0 || fwrite(padding, 1, npadding, file) == npadding;
+}
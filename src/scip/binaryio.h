@@ -0,0 +1,122 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   binaryio.h
+ * @brief  methods for reading and writing the binary files of SCIP, such as snapshots and cached presolved problems
+ *
+ * A binary file starts with a header that identifies the type of the file, the version of its format, and the byte
+ * order of the machine that wrote it. The data that follows is stored in the byte order of this machine, and every
+ * array starts at a multiple of 8 bytes, such that an uncompressed file can also be memory mapped directly.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_BINARYIO_H__
+#define __SCIP_BINARYIO_H__
+
+#include <stdio.h>
+
+#include "scip/def.h"
+#include "scip/pub_fileio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCIP_BINARYIO_BYTEORDER        0x01020304   /**< byte order mark to recognize files of different endianness */
+#define SCIP_BINARYIO_BYTEORDERSWAPPED 0x04030201   /**< byte order mark as read on a machine of different endianness */
+
+/** leading part of the header of each binary file */
+struct SCIP_BinaryHeader
+{
+   char                  magic[8];           /**< magic string of the file type */
+   int                   version;            /**< version of the file format */
+   int                   byteorder;          /**< byte order mark SCIP_BINARYIO_BYTEORDER */
+};
+typedef struct SCIP_BinaryHeader SCIP_BINARYHEADER;
+
+/** result of checking the leading part of the header of a binary file */
+enum SCIP_BinaryStatus
+{
+   SCIP_BINARYSTATUS_OK        = 0,          /**< the file has the expected type and version and can be read */
+   SCIP_BINARYSTATUS_WRONGTYPE = 1,          /**< the file has a different magic string */
+   SCIP_BINARYSTATUS_SWAPPED   = 2,          /**< the file was written on a machine of different byte order */
+   SCIP_BINARYSTATUS_CORRUPTED = 3,          /**< the byte order mark of the file is invalid */
+   SCIP_BINARYSTATUS_VERSION   = 4           /**< the file has a different version of the format */
+};
+typedef enum SCIP_BinaryStatus SCIP_BINARYSTATUS;
+
+/** initializes the leading part of the header of a binary file written on this machine */
+SCIP_EXPORT
+void SCIPbinaryInitHeader(
+   SCIP_BINARYHEADER*    header,             /**< header to initialize */
+   const char*           magic,              /**< magic string of the file type, at most 7 characters */
+   int                   version             /**< version of the file format */
+   );
+
+/** checks the leading part of the header of a binary file that was read from disk */
+SCIP_EXPORT
+SCIP_BINARYSTATUS SCIPbinaryCheckHeader(
+   const SCIP_BINARYHEADER* header,          /**< header to check */
+   const char*           magic,              /**< expected magic string of the file type */
+   int                   version             /**< expected version of the file format */
+   );
+
+/** reads an array and the padding behind it; returns whether the read was successful */
+SCIP_EXPORT
+SCIP_Bool SCIPbinaryReadArray(
+   SCIP_FILE*            fp,                 /**< file to read from */
+   void*                 data,               /**< array to store the data */
+   size_t                size,               /**< size of an element in bytes */
+   size_t                n                   /**< number of elements */
+   );
+
+/** writes an array and fills up the file to a multiple of 8 bytes; returns whether the write was successful */
+SCIP_EXPORT
+SCIP_Bool SCIPbinaryWriteArray(
+   FILE*                 file,               /**< file to write to */
+   const void*           data,               /**< array to write */
+   size_t                size,               /**< size of an element in bytes */
+   size_t                n                   /**< number of elements */
+   );
+
+/** writes a null-terminated string without padding; returns whether the write was successful */
+SCIP_EXPORT
+SCIP_Bool SCIPbinaryWriteString(
+   FILE*                 file,               /**< file to write to */
+   const char*           str                 /**< string to write */
+   );
+
+/** fills up the file to a multiple of 8 bytes after data of the given size; returns whether the write was successful */
+SCIP_EXPORT
+SCIP_Bool SCIPbinaryWritePadding(
+   FILE*                 file,               /**< file to write to */
+   size_t                nbytes              /**< size of the written data in bytes */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
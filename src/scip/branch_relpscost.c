@@ -1860,7 +1860,12 @@ SCIP_RETCODE execRelpscost(
          }
          else
          {
-            /* apply strong branching */
+            /* apply strong branching
+             *
+             * @todo evaluate several candidates in one call once an LP interface shares work between the columns of
+             *       SCIPgetVarsStrongbranchesFrac(); the batch would then need the same pseudo objective strengthening,
+             *       column updates and cutoff checks per candidate as SCIPgetVarStrongbranchFrac()
+             */
             SCIP_CALL( SCIPgetVarStrongbranchFrac(scip, branchcands[c], inititer, FALSE,
                   &down, &up, &downvalid, &upvalid, &downinf, &upinf, &downconflict, &upconflict, &lperror) );
 
@@ -74,9 +74,101 @@
 /** event handler data */
 struct SCIP_EventhdlrData
 {
+   SCIP_CONCSOLVER* concsolver;              /**< the concurrent solver this event handler belongs to */
+   SCIP_Longint    lastpublished;            /**< number of the published solution that was read last */
    int             filterpos;
+   int             solfilterpos;             /**< filter position for best solution and node focus events */
 };
 
+/** data for a concurrent solver */
+struct SCIP_ConcSolverData
+{
+   SCIP*                 solverscip;         /**< the concurrent solvers private SCIP data structure */
+   SCIP_VAR**            vars;               /**< array of variables in the order of the main SCIP's variable array */
+   int                   nvars;              /**< number of variables in the above arrays */
+};
+
+/** publishes a new best solution of the concurrent solver, so that the other solvers can read it immediately */
+static
+SCIP_RETCODE publishBestSol(
+   SCIP*                 scip,               /**< SCIP data structure of the concurrent solver */
+   SCIP_EVENTHDLRDATA*   eventhdlrdata,      /**< event handler data */
+   SCIP_SOL*             sol                 /**< new best solution */
+   )
+{
+   SCIP_CONCSOLVERDATA* data;
+   SCIP_Real* solvals;
+   SCIP_Real solobj;
+   SCIP_Bool published;
+
+   data = SCIPconcsolverGetData(eventhdlrdata->concsolver);
+   assert(data != NULL);
+   assert(data->solverscip == scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, data->nvars) );
+   SCIP_CALL( SCIPgetSolVals(scip, sol, data->nvars, data->vars, solvals) );
+
+   /* scale the objective value by the objective sense, so that the syncstore can always minimize */
+   solobj = (int)SCIPgetObjsense(scip) * SCIPgetSolOrigObj(scip, sol);
+
+   SCIP_CALL( SCIPsyncstorePublishSolution(SCIPgetSyncstore(scip), solobj, SCIPconcsolverGetIdx(eventhdlrdata->concsolver),
+         solvals, data->nvars, &published) );
+
+   SCIPfreeBufferArray(scip, &solvals);
+
+   return SCIP_OKAY;
+}
+
+/** passes the solution published by another solver to the sync heuristic, if it is better than the own incumbent */
+static
+SCIP_RETCODE readPublishedSol(
+   SCIP*                 scip,               /**< SCIP data structure of the concurrent solver */
+   SCIP_EVENTHDLRDATA*   eventhdlrdata       /**< event handler data */
+   )
+{
+   SCIP_CONCSOLVERDATA* data;
+   SCIP_Real* solvals;
+   SCIP_Real solobj;
+   SCIP_Bool found;
+
+   /* nothing to do if no solution has been published since the last call */
+   if( SCIPsyncstoreGetNPublishedSolutions(SCIPgetSyncstore(scip)) <= eventhdlrdata->lastpublished )
+      return SCIP_OKAY;
+
+   data = SCIPconcsolverGetData(eventhdlrdata->concsolver);
+   assert(data != NULL);
+   assert(data->solverscip == scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, data->nvars) );
+   SCIP_CALL( SCIPsyncstoreGetPublishedSolution(SCIPgetSyncstore(scip), SCIPconcsolverGetIdx(eventhdlrdata->concsolver),
+         &eventhdlrdata->lastpublished, solvals, data->nvars, &solobj, &found) );
+
+   if( found && SCIPisLT(scip, solobj, (int)SCIPgetObjsense(scip) * SCIPgetPrimalbound(scip)) )
+   {
+      SCIP_SOL* newsol;
+      SCIP_Bool feasible;
+
+      SCIP_CALL( SCIPcreateOrigSol(scip, &newsol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, newsol, data->nvars, data->vars, solvals) );
+
+      /* check whether solution is feasible, like for solutions that are read in a synchronization */
+      SCIP_CALL( SCIPcheckSol(scip, newsol, FALSE, FALSE, TRUE, TRUE, FALSE, &feasible) );
+
+      if( feasible )
+      {
+         SCIP_CALL( SCIPaddConcurrentSol(scip, newsol) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPfreeSol(scip, &newsol) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &solvals);
+
+   return SCIP_OKAY;
+}
+
 /*
  * Callback methods of event handler
  */
@@ -124,6 +216,14 @@ SCIP_DECL_EVENTINIT(eventInitSync)
    {
       /* notify SCIP that your event handler wants to react on synchronization events */
       SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_SYNC, eventhdlr, NULL, &eventhdlrdata->filterpos) );
+
+      /* in opportunistic mode, new best solutions are shared immediately and read at every node */
+      if( eventhdlrdata->solfilterpos < 0 && SCIPsyncstoreGetMode(syncstore) == SCIP_PARA_OPPORTUNISTIC )
+      {
+         eventhdlrdata->lastpublished = 0;
+         SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_NODEFOCUSED, eventhdlr, NULL,
+               &eventhdlrdata->solfilterpos) );
+      }
    }
 
    return SCIP_OKAY;
@@ -150,6 +250,13 @@ SCIP_DECL_EVENTEXIT(eventExitSync)
       eventhdlrdata->filterpos = -1;
    }
 
+   if( eventhdlrdata->solfilterpos >= 0 )
+   {
+      SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_NODEFOCUSED, eventhdlr, NULL,
+            eventhdlrdata->solfilterpos) );
+      eventhdlrdata->solfilterpos = -1;
+   }
+
    return SCIP_OKAY;
 }
 
@@ -157,13 +264,29 @@ SCIP_DECL_EVENTEXIT(eventExitSync)
 static
 SCIP_DECL_EVENTEXEC(eventExecSync)
 {  /*lint --e{715}*/
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+
    assert(eventhdlr != NULL);
    assert(event != NULL);
    assert(scip != NULL);
 
    SCIP_STRINGEQ( SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME, SCIP_INVALIDCALL );
 
-   SCIP_CALL( SCIPsynchronize(scip) );
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+   assert(eventhdlrdata != NULL);
+
+   switch( SCIPeventGetType(event) )
+   {
+   case SCIP_EVENTTYPE_BESTSOLFOUND:
+      SCIP_CALL( publishBestSol(scip, eventhdlrdata, SCIPeventGetSol(event)) );
+      break;
+   case SCIP_EVENTTYPE_NODEFOCUSED:
+      SCIP_CALL( readPublishedSol(scip, eventhdlrdata) );
+      break;
+   default:
+      SCIP_CALL( SCIPsynchronize(scip) );
+      break;
+   }
 
    return SCIP_OKAY;
 }
@@ -172,14 +295,18 @@ SCIP_DECL_EVENTEXEC(eventExecSync)
 /** includes event handler for synchronization found */
 static
 SCIP_RETCODE includeEventHdlrSync(
-   SCIP*                 scip                /**< SCIP data structure */
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONCSOLVER*      concsolver          /**< the concurrent solver of the SCIP instance */
    )
 {
    SCIP_EVENTHDLR*     eventhdlr;
    SCIP_EVENTHDLRDATA* eventhdlrdata;
 
    SCIP_CALL( SCIPallocBlockMemory(scip, &eventhdlrdata) );
+   eventhdlrdata->concsolver = concsolver;
+   eventhdlrdata->lastpublished = 0;
    eventhdlrdata->filterpos = -1;
+   eventhdlrdata->solfilterpos = -1;
 
    /* create event handler for events on watched variables */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecSync, eventhdlrdata) );
@@ -199,14 +326,6 @@ struct SCIP_ConcSolverTypeData
    SCIP_PARAMEMPHASIS    emphasis;           /**< parameter emphasis that will be loaded if loademphasis is true */
 };
 
-/** data for a concurrent solver */
-struct SCIP_ConcSolverData
-{
-   SCIP*                 solverscip;         /**< the concurrent solvers private SCIP data structure */
-   SCIP_VAR**            vars;               /**< array of variables in the order of the main SCIP's variable array */
-   int                   nvars;              /**< number of variables in the above arrays */
-};
-
 /** Disable dual reductions that might cut off optimal solutions. Although they keep at least
  *  one optimal solution intact, communicating these bounds may cut off all optimal solutions,
  *  if different optimal solutions were kept in different concurrent solvers. */
@@ -475,7 +594,7 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    }
 
    /* include eventhandler for synchronization */
-   SCIP_CALL( includeEventHdlrSync(data->solverscip) );
+   SCIP_CALL( includeEventHdlrSync(data->solverscip, concsolver) );
 
    /* disable output for subscip */
    SCIP_CALL( SCIPsetIntParam(data->solverscip, "display/verblevel", 0) );
@@ -841,14 +960,14 @@ SCIP_DECL_CONCSOLVERSYNCREAD(concsolverScipSyncRead)
 
       /* cannot change bounds of multi-aggregated variables so do not pass this bound-change to the propagator */
       if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_MULTAGGR )
-         return SCIP_OKAY;
+         continue;
 
       /* if bound is not better then do not pass this bound and do not waste memory for storing this boundchange */
       if( boundtype == SCIP_BOUNDTYPE_LOWER && SCIPisGE(data->solverscip, SCIPvarGetLbGlobal(var), newbound) )
-         return SCIP_OKAY;
+         continue;
 
       if( boundtype == SCIP_BOUNDTYPE_UPPER && SCIPisLE(data->solverscip, SCIPvarGetUbGlobal(var), newbound) )
-         return SCIP_OKAY;
+         continue;
 
       /* bound is better so incremented counters for statistics and pass it to the sync propagator */
       ++(*ntighterbnds);
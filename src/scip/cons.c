@@ -2230,6 +2230,7 @@ SCIP_RETCODE doConshdlrCreate(
    (*conshdlr)->delayupdatecount = 0;
    (*conshdlr)->ageresetavg = AGERESETAVG_INIT;
    (*conshdlr)->needscons = needscons;
+   (*conshdlr)->propmarkedonly = FALSE;
    (*conshdlr)->sepalpwasdelayed = FALSE;
    (*conshdlr)->sepasolwasdelayed = FALSE;
    (*conshdlr)->propwasdelayed = FALSE;
@@ -3947,6 +3948,7 @@ SCIP_RETCODE SCIPconshdlrPropagate(
          int nusefulconss;
          int nmarkedpropconss;
          int firstcons;
+         SCIP_Bool callprop;
 
          /* check, if the current domains were already propagated */
          if( !fullpropagation && conshdlr->lastpropdomchgcount == stat->domchgcount && conshdlr->nmarkedpropconss == 0 )
@@ -3972,8 +3974,23 @@ SCIP_RETCODE SCIPconshdlrPropagate(
          nmarkedpropconss = conshdlr->nmarkedpropconss;
 
          /* constraint handlers without constraints should only be called once */
-         if( nconss > 0 || fullpropagation
-            || (!conshdlr->needscons && conshdlr->lastpropdomchgcount != stat->domchgcount) )
+         callprop = nconss > 0 || fullpropagation
+            || (!conshdlr->needscons && conshdlr->lastpropdomchgcount != stat->domchgcount);
+
+         if( callprop && conshdlr->propmarkedonly && nmarkedpropconss == 0 )
+         {
+            /* constraint handlers that only process marked constraints need not be called if no constraint is marked
+             * for propagation; count the call as if the handler had not found a reduction, such that the statistics
+             * and the eager evaluation frequency are the same as when calling it
+             */
+            SCIPsetDebugMsg(set, "skipping propagation of handler <%s> without marked constraints\n", conshdlr->name);
+
+            conshdlr->lastpropdomchgcount = stat->domchgcount;
+            conshdlr->lastnusefulpropconss = conshdlr->nusefulpropconss;
+            conshdlr->npropcalls++;
+            *result = SCIP_DIDNOTFIND;
+         }
+         else if( callprop )
          {
             SCIP_CONS** conss;
             SCIP_Longint oldndomchgs;
@@ -5323,6 +5340,29 @@ void SCIPconshdlrSetNeedsCons(
    conshdlr->needscons = needscons;
 }
 
+/** does the propagation method of the constraint handler only process constraints marked for propagation? */
+SCIP_Bool SCIPconshdlrIsPropMarkedOnly(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   )
+{
+   assert(conshdlr != NULL);
+
+   return conshdlr->propmarkedonly;
+}
+
+/** sets the propmarkedonly flag of constraint handler; if it is set, the propagation method is only called if a
+ *  constraint of the handler is marked for propagation
+ */
+void SCIPconshdlrSetPropMarkedOnly(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_Bool             propmarkedonly      /**< does the propagation method only process marked constraints? */
+   )
+{
+   assert(conshdlr != NULL);
+
+   conshdlr->propmarkedonly = propmarkedonly;
+}
+
 /** does the constraint handler perform presolving? */
 SCIP_Bool SCIPconshdlrDoesPresolve(
    SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
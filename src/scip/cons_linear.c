@@ -1302,26 +1302,67 @@ SCIP_Real consdataComputePseudoActivity(
    return pseudoactivity;
 }
 
-/** recompute the minactivity of a constraint */
+/** sums up the contributions of the variables to the minimal or maximal activity of a constraint
+ *
+ *  Infinite and huge contributions are skipped, since they are counted separately. The bounds for the infinity and huge
+ *  value checks are fetched once in advance, such that the loop only reads the coefficients and the variable bounds.
+ */
 static
-void consdataRecomputeMinactivity(
+void consdataSumActivity(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_CONSDATA*        consdata            /**< linear constraint data */
+   SCIP_CONSDATA*        consdata,           /**< linear constraint data */
+   SCIP_Bool             minact,             /**< should the minimal activity be computed (otherwise the maximal one)? */
+   SCIP_Bool             global,             /**< should the global bounds be used (otherwise the local ones)? */
+   QUAD(SCIP_Real*       activity)           /**< pointer to store the sum of the finite and non-huge contributions */
    )
 {
-   int i;
+   SCIP_VAR** vars;
+   SCIP_Real* vals;
+   SCIP_Real QUAD(sum);
+   SCIP_Real infinity;
+   SCIP_Real hugeval;
+   SCIP_Real contribution;
    SCIP_Real bound;
+   int i;
 
-   QUAD_ASSIGN(consdata->minactivity, 0.0);
+   assert(consdata != NULL);
+
+   vars = consdata->vars;
+   vals = consdata->vals;
+   infinity = SCIPinfinity(scip);
+   hugeval = SCIPgetHugeValue(scip);
+
+   QUAD_ASSIGN(sum, 0.0);
 
    for( i = consdata->nvars - 1; i >= 0; --i )
    {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetLbLocal(consdata->vars[i]) : SCIPvarGetUbLocal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->minactivity, consdata->minactivity, consdata->vals[i] * bound);
+      /* the minimal activity uses the lower bounds of variables with positive coefficients and the upper bounds of
+       * variables with negative coefficients, the maximal activity vice versa
+       */
+      if( vals[i] > 0.0 ? minact : !minact )
+         bound = global ? SCIPvarGetLbGlobal(vars[i]) : SCIPvarGetLbLocal(vars[i]);
+      else
+         bound = global ? SCIPvarGetUbGlobal(vars[i]) : SCIPvarGetUbLocal(vars[i]);
+
+      contribution = vals[i] * bound;
+
+      /* this equals !SCIPisInfinity(scip, REALABS(bound)) && !SCIPisHugeValue(scip, REALABS(contribution)) */
+      if( REALABS(bound) < infinity && REALABS(contribution) < hugeval )
+         SCIPquadprecSumQD(sum, sum, contribution);
    }
 
+   QUAD_ASSIGN_Q(*activity, sum);
+}
+
+/** recompute the minactivity of a constraint */
+static
+void consdataRecomputeMinactivity(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata            /**< linear constraint data */
+   )
+{
+   consdataSumActivity(scip, consdata, TRUE, FALSE, QUAD(&consdata->minactivity));
+
    /* the activity was just computed from scratch and is valid now */
    consdata->validminact = TRUE;
 
@@ -1336,18 +1377,7 @@ void consdataRecomputeMaxactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
-   SCIP_Real bound;
-
-   QUAD_ASSIGN(consdata->maxactivity, 0.0);
-
-   for( i = consdata->nvars - 1; i >= 0; --i )
-   {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetUbLocal(consdata->vars[i]) : SCIPvarGetLbLocal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->maxactivity, consdata->maxactivity, consdata->vals[i] * bound);
-   }
+   consdataSumActivity(scip, consdata, FALSE, FALSE, QUAD(&consdata->maxactivity));
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validmaxact = TRUE;
@@ -1363,18 +1393,7 @@ void consdataRecomputeGlbMinactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
-   SCIP_Real bound;
-
-   QUAD_ASSIGN(consdata->glbminactivity, 0.0);
-
-   for( i = consdata->nvars - 1; i >= 0; --i )
-   {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetLbGlobal(consdata->vars[i]) : SCIPvarGetUbGlobal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->glbminactivity, consdata->glbminactivity, consdata->vals[i] * bound);
-   }
+   consdataSumActivity(scip, consdata, TRUE, TRUE, QUAD(&consdata->glbminactivity));
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validglbminact = TRUE;
@@ -1390,18 +1409,7 @@ void consdataRecomputeGlbMaxactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
-   SCIP_Real bound;
-
-   QUAD_ASSIGN(consdata->glbmaxactivity, 0.0);
-
-   for( i = consdata->nvars - 1; i >= 0; --i )
-   {
-      bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetUbGlobal(consdata->vars[i]) : SCIPvarGetLbGlobal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         SCIPquadprecSumQD(consdata->glbmaxactivity, consdata->glbmaxactivity, consdata->vals[i] * bound);
-   }
+   consdataSumActivity(scip, consdata, FALSE, TRUE, QUAD(&consdata->glbmaxactivity));
 
    /* the activity was just computed from scratch and is valid now */
    consdata->validglbmaxact = TRUE;
@@ -17576,6 +17584,7 @@ SCIP_RETCODE SCIPincludeConshdlrLinear(
    SCIP_CALL( SCIPsetConshdlrPrint(scip, conshdlr, consPrintLinear) );
    SCIP_CALL( SCIPsetConshdlrProp(scip, conshdlr, consPropLinear, CONSHDLR_PROPFREQ, CONSHDLR_DELAYPROP,
          CONSHDLR_PROP_TIMING) );
+   SCIPconshdlrSetPropMarkedOnly(conshdlr, TRUE);
    SCIP_CALL( SCIPsetConshdlrResprop(scip, conshdlr, consRespropLinear) );
    SCIP_CALL( SCIPsetConshdlrSepa(scip, conshdlr, consSepalpLinear, consSepasolLinear, CONSHDLR_SEPAFREQ,
          CONSHDLR_SEPAPRIORITY, CONSHDLR_DELAYSEPA) );
@@ -120,6 +120,9 @@
 #define DEFAULT_CLIQUESHRINKING    TRUE /**< should we try to shrink the number of variables in a clique constraints, by
                                          *   replacing more than one variable by only one
                                          */
+#define DEFAULT_WATCHEDVARS        TRUE /**< should fixings to zero only be caught for two watched variables of each
+                                         *   constraint during the solving process?
+                                         */
 
 /* @todo maybe use event SCIP_EVENTTYPE_VARUNLOCKED to decide for another dual-presolving run on a constraint */
 
@@ -156,6 +159,9 @@ struct SCIP_ConshdlrData
    SCIP_Bool             presolusehashing;   /**< should hash table be used for detecting redundant constraints in advance */
    SCIP_Bool             copytypedcons;      /**< should setppc constraints be copied as setppc instead of linear? */
    SCIP_Bool             dualpresolving;     /**< should dual presolving steps be performed? */
+   SCIP_Bool             watchedvars;        /**< should fixings to zero only be caught for two watched variables of each
+                                              *   constraint during the solving process?
+                                              */
    int*                  probtoidxmap;       /**< cleared memory array with default values -1; used for clique partitions */
    int                   probtoidxmapsize;   /**< size of probtoidxmap */
 };
@@ -169,8 +175,13 @@ struct SCIP_ConsData
    SCIP_VAR**            vars;               /**< variables of the constraint */
    int                   varssize;           /**< size of vars array */
    int                   nvars;              /**< number of variables in the constraint */
-   int                   nfixedzeros;        /**< current number of variables fixed to zero in the constraint */
+   int                   nfixedzeros;        /**< current number of variables fixed to zero in the constraint, if no
+                                              *   watched variables are used */
    int                   nfixedones;         /**< current number of variables fixed to one in the constraint */
+   int                   watchedvar1;        /**< position of the first watched variable */
+   int                   watchedvar2;        /**< position of the second watched variable */
+   int                   filterpos1;         /**< event filter position of first watched variable */
+   int                   filterpos2;         /**< event filter position of second watched variable */
    unsigned int          setppctype:2;       /**< type of constraint: set partitioning, packing or covering */
    unsigned int          sorted:1;           /**< are the constraint's variables sorted? */
    unsigned int          cliqueadded:1;      /**< was the set partitioning / packing constraint already added as clique? */
@@ -181,6 +192,7 @@ struct SCIP_ConsData
    unsigned int          presolpropagated:1; /**< was the constraint already propagated in presolving w.r.t. the current domains? */
    unsigned int          existmultaggr:1;    /**< does this constraint contain aggregations */
    unsigned int          catchevents:1;      /**< are events installed for this constraint? */
+   unsigned int          watched:1;          /**< are fixings to zero only caught for the two watched variables? */
 };
 
 
@@ -590,8 +602,13 @@ SCIP_RETCODE consdataCreate(
    (*consdata)->nlrow = NULL;
    (*consdata)->existmultaggr = FALSE;
    (*consdata)->catchevents = FALSE;
+   (*consdata)->watched = FALSE;
    (*consdata)->nfixedzeros = 0;
    (*consdata)->nfixedones = 0;
+   (*consdata)->watchedvar1 = -1;
+   (*consdata)->watchedvar2 = -1;
+   (*consdata)->filterpos1 = -1;
+   (*consdata)->filterpos2 = -1;
 
    if( nvars > 0 )
    {
@@ -811,6 +828,7 @@ void consdataSort(
    )
 {
    assert(consdata != NULL);
+   assert(consdata->sorted || consdata->watchedvar1 == -1);
 
    if( !consdata->sorted )
    {
@@ -852,6 +870,7 @@ SCIP_RETCODE setSetppcType(
 
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
+   assert(!consdata->watched);
 
    if( (SCIP_SETPPCTYPE)consdata->setppctype == setppctype )
       return SCIP_OKAY;
@@ -909,6 +928,114 @@ SCIP_RETCODE setSetppcType(
    return SCIP_OKAY;
 }
 
+/** stores the given variable numbers as watched variables, and updates the event processing */
+static
+SCIP_RETCODE switchWatchedvars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< set partitioning / packing / covering constraint */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler to call for the event processing */
+   int                   watchedvar1,        /**< new first watched variable */
+   int                   watchedvar2         /**< new second watched variable */
+   )
+{
+   SCIP_CONSDATA* consdata;
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+   assert(watchedvar1 == -1 || watchedvar1 != watchedvar2);
+   assert(watchedvar1 != -1 || watchedvar2 == -1);
+   assert(watchedvar1 == -1 || (0 <= watchedvar1 && watchedvar1 < consdata->nvars));
+   assert(watchedvar2 == -1 || (0 <= watchedvar2 && watchedvar2 < consdata->nvars));
+
+   /* if one watched variable is equal to the old other watched variable, just switch positions */
+   if( watchedvar1 == consdata->watchedvar2 || watchedvar2 == consdata->watchedvar1 )
+   {
+      int tmp;
+
+      tmp = consdata->watchedvar1;
+      consdata->watchedvar1 = consdata->watchedvar2;
+      consdata->watchedvar2 = tmp;
+      tmp = consdata->filterpos1;
+      consdata->filterpos1 = consdata->filterpos2;
+      consdata->filterpos2 = tmp;
+   }
+   assert(watchedvar1 == -1 || watchedvar1 != consdata->watchedvar2);
+   assert(watchedvar2 == -1 || watchedvar2 != consdata->watchedvar1);
+
+   /* drop events on old watched variables */
+   if( consdata->watchedvar1 != -1 && consdata->watchedvar1 != watchedvar1 )
+   {
+      assert(consdata->filterpos1 != -1);
+      SCIP_CALL( SCIPdropVarEvent(scip, consdata->vars[consdata->watchedvar1], SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr,
+            (SCIP_EVENTDATA*)cons, consdata->filterpos1) );
+   }
+   if( consdata->watchedvar2 != -1 && consdata->watchedvar2 != watchedvar2 )
+   {
+      assert(consdata->filterpos2 != -1);
+      SCIP_CALL( SCIPdropVarEvent(scip, consdata->vars[consdata->watchedvar2], SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr,
+            (SCIP_EVENTDATA*)cons, consdata->filterpos2) );
+   }
+
+   /* catch events on new watched variables */
+   if( watchedvar1 != -1 && watchedvar1 != consdata->watchedvar1 )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, consdata->vars[watchedvar1], SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr,
+            (SCIP_EVENTDATA*)cons, &consdata->filterpos1) );
+   }
+   if( watchedvar2 != -1 && watchedvar2 != consdata->watchedvar2 )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, consdata->vars[watchedvar2], SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr,
+            (SCIP_EVENTDATA*)cons, &consdata->filterpos2) );
+   }
+
+   /* set the new watched variables */
+   consdata->watchedvar1 = watchedvar1;
+   consdata->watchedvar2 = watchedvar2;
+
+   return SCIP_OKAY;
+}
+
+/** watches the first two variables of the constraint that are not fixed to zero, and marks the constraint for
+ *  propagation if there are less than two such variables
+ */
+static
+SCIP_RETCODE watchUnfixedVars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< set partitioning / packing / covering constraint */
+   SCIP_EVENTHDLR*       eventhdlr           /**< event handler to call for the event processing */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   int watchedvar1 = -1;
+   int watchedvar2 = -1;
+   int v;
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+   assert(consdata->watched);
+
+   for( v = 0; v < consdata->nvars && watchedvar2 == -1; ++v )
+   {
+      if( SCIPvarGetUbLocal(consdata->vars[v]) > 0.5 )
+      {
+         if( watchedvar1 == -1 )
+            watchedvar1 = v;
+         else
+            watchedvar2 = v;
+      }
+   }
+
+   SCIP_CALL( switchWatchedvars(scip, cons, eventhdlr, watchedvar1, watchedvar2) );
+
+   /* if less than two variables are not fixed to zero, the constraint has to be processed */
+   if( watchedvar2 == -1 && SCIPconsIsActive(cons) )
+   {
+      SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** catches events for variable at given position */
 static
 SCIP_RETCODE catchEvent(
@@ -934,7 +1061,10 @@ SCIP_RETCODE catchEvent(
    /* we are catching the following events:
     *
     * - SCIP_EVENTTYPE_BOUNDCHANGED: Is used to count the number of variable fixed locally to zero and one. That helps
-    *                                to speed up the propagation
+    *                                to speed up the propagation. If watched variables are used, only
+    *                                SCIP_EVENTTYPE_LBCHANGED is caught here to count the variables fixed to one, and
+    *                                fixings to zero are only caught for the two watched variables, see
+    *                                switchWatchedvars().
     *
     * - SCIP_EVENTTYPE_VARDELETED: Is caught to remove a deleted variable from the constraint
     *
@@ -943,14 +1073,22 @@ SCIP_RETCODE catchEvent(
     *                            this could lead to a redundant constraint if the (other) active variable is also part
     *                            of the constraint.
     */
-   eventtype =  SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   if( consdata->watched )
+      eventtype = SCIP_EVENTTYPE_LBCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   else
+      eventtype = SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
 
    /* catch bound change events on variable */
    SCIP_CALL( SCIPcatchVarEvent(scip, var, eventtype, eventhdlr, (SCIP_EVENTDATA*)cons, NULL) );
 
-   /* update the fixed variables counters for this variable */
+   /* update the fixed variables counters for this variable; fixings to zero are not counted if watched variables are
+    * used
+    */
    if( SCIPisEQ(scip, SCIPvarGetUbLocal(var), 0.0) )
    {
+      if( consdata->watched )
+         return SCIP_OKAY;
+
       consdata->nfixedzeros++;
 
       /* during presolving, we may fix the last unfixed variable or do an aggregation if there are two unfixed variables */
@@ -1001,14 +1139,20 @@ SCIP_RETCODE dropEvent(
    var = consdata->vars[pos];
    assert(var != NULL);
 
-   eventtype =  SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   if( consdata->watched )
+      eventtype = SCIP_EVENTTYPE_LBCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
+   else
+      eventtype = SCIP_EVENTTYPE_BOUNDCHANGED | SCIP_EVENTTYPE_VARDELETED | SCIP_EVENTTYPE_VARFIXED;
 
    /* drop events on variable */
    SCIP_CALL( SCIPdropVarEvent(scip, var, eventtype, eventhdlr, (SCIP_EVENTDATA*)cons, -1) );
 
    /* update the fixed variables counters for this variable */
    if( SCIPisEQ(scip, SCIPvarGetUbLocal(var), 0.0) )
-      consdata->nfixedzeros--;
+   {
+      if( !consdata->watched )
+         consdata->nfixedzeros--;
+   }
    else if( SCIPisEQ(scip, SCIPvarGetLbLocal(var), 1.0) )
       consdata->nfixedones--;
 
@@ -1038,6 +1182,12 @@ SCIP_RETCODE catchAllEvents(
       SCIP_CALL( catchEvent(scip, cons, eventhdlr, i) );
    }
 
+   /* watch the first two variables that are not fixed to zero */
+   if( consdata->watched )
+   {
+      SCIP_CALL( watchUnfixedVars(scip, cons, eventhdlr) );
+   }
+
    consdata->catchevents = TRUE;
 
    return SCIP_OKAY;
@@ -1066,11 +1216,52 @@ SCIP_RETCODE dropAllEvents(
       SCIP_CALL( dropEvent(scip, cons, eventhdlr, i) );
    }
 
+   /* stop watching variables */
+   if( consdata->watched )
+   {
+      SCIP_CALL( switchWatchedvars(scip, cons, eventhdlr, -1, -1) );
+   }
+
    consdata->catchevents = FALSE;
 
    return SCIP_OKAY;
 }
 
+/** switches the bound change events of a transformed setppc constraint between counting all variables fixed to zero
+ *  and catching fixings to zero only for two watched variables
+ *
+ *  Using watched variables avoids the event processing for most fixings to zero, which only lead to a propagation or,
+ *  for set packing constraints, to disabling the constraint if at most one variable is left that is not fixed to zero.
+ *  Fixings to one are still counted for all variables, because each of them leads to a propagation in set partitioning
+ *  and packing constraints.
+ */
+static
+SCIP_RETCODE setWatchedEvents(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< set partitioning / packing / covering constraint */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler to call for the event processing */
+   SCIP_Bool             watched             /**< should fixings to zero only be caught for two watched variables? */
+   )
+{
+   SCIP_CONSDATA* consdata;
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+
+   if( (SCIP_Bool)consdata->watched == watched || !consdata->catchevents )
+      return SCIP_OKAY;
+
+   SCIP_CALL( dropAllEvents(scip, cons, eventhdlr) );
+   assert(consdata->nfixedzeros == 0);
+   assert(consdata->nfixedones == 0);
+
+   consdata->watched = watched;
+
+   SCIP_CALL( catchAllEvents(scip, cons, eventhdlr) );
+
+   return SCIP_OKAY;
+}
+
 /** adds coefficient in setppc constraint */
 static
 SCIP_RETCODE addCoef(
@@ -1126,6 +1317,14 @@ SCIP_RETCODE addCoef(
       if( consdata->catchevents )
       {
          SCIP_CALL( catchEvent(scip, cons, conshdlrdata->eventhdlr, consdata->nvars-1) );
+
+         /* if less than two watched variables are not fixed to zero, the new variable may become a watched one */
+         if( consdata->watched && SCIPvarGetUbLocal(var) > 0.5 && (consdata->watchedvar2 == -1
+               || SCIPvarGetUbLocal(consdata->vars[consdata->watchedvar1]) < 0.5
+               || SCIPvarGetUbLocal(consdata->vars[consdata->watchedvar2]) < 0.5) )
+         {
+            SCIP_CALL( watchUnfixedVars(scip, cons, conshdlrdata->eventhdlr) );
+         }
       }
 
       if( !consdata->existmultaggr && SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_MULTAGGR )
@@ -1198,6 +1397,26 @@ SCIP_RETCODE delCoefPos(
          SCIP_CALL( dropEvent(scip, cons, conshdlrdata->eventhdlr, pos) );
       }
 
+      /* if the position is watched, stop watching the position and process the constraint to find a new one */
+      if( consdata->watchedvar1 == pos || consdata->watchedvar2 == pos )
+      {
+         if( consdata->watchedvar1 == pos )
+         {
+            SCIP_CALL( switchWatchedvars(scip, cons, conshdlrdata->eventhdlr, consdata->watchedvar2, -1) );
+         }
+         else
+         {
+            SCIP_CALL( switchWatchedvars(scip, cons, conshdlrdata->eventhdlr, consdata->watchedvar1, -1) );
+         }
+
+         if( SCIPconsIsActive(cons) )
+         {
+            SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+         }
+      }
+      assert(pos != consdata->watchedvar1);
+      assert(pos != consdata->watchedvar2);
+
       /* the last variable of the constraint was deleted; mark it for propagation (so that it can be deleted) */
       if( consdata->nvars == 1 )
       {
@@ -1218,6 +1437,13 @@ SCIP_RETCODE delCoefPos(
       consdata->sorted = FALSE;
    }
    consdata->nvars--;
+
+   /* if the last variable (that moved) was watched, update the watched position */
+   if( consdata->watchedvar1 == consdata->nvars )
+      consdata->watchedvar1 = pos;
+   if( consdata->watchedvar2 == consdata->nvars )
+      consdata->watchedvar2 = pos;
+
    consdata->validsignature = FALSE;
    consdata->changed = TRUE;
 
@@ -1668,6 +1894,7 @@ SCIP_RETCODE mergeMultiples(
    assert(consdata->vars != NULL || consdata->nvars == 0);
 
    /* sorting array after indices of variables, that's only for faster merging */
+   assert(consdata->watchedvar1 == -1);
    SCIPsortPtr((void**)consdata->vars, SCIPvarCompActiveAndNegated, consdata->nvars);
    /* setppc sorting now lost */
    consdata->sorted = FALSE;
@@ -2165,6 +2392,94 @@ SCIP_RETCODE analyzeConflictOne(
    return SCIP_OKAY;
 }
 
+/** checks the watched variables of a constraint that catches fixings to zero only for two watched variables, and
+ *  counts the variables fixed to zero if this number is needed by processFixings()
+ *
+ *  The number of variables fixed to zero is only needed if exactly one variable is fixed to one or if at most one
+ *  variable is not fixed to zero in a set partitioning or covering constraint. Otherwise, the watched variables are moved
+ *  to two variables that are not fixed to zero.
+ */
+static
+SCIP_RETCODE processWatchedVars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< set partitioning / packing / covering constraint to be processed */
+   int*                  nfixedzeros         /**< pointer to store the number of variables fixed to zero, or 0 if it is not
+                                              *   needed */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSDATA* consdata;
+   SCIP_VAR** vars;
+   int watchedvar1;
+   int watchedvar2;
+   int nvars;
+   int v;
+
+   assert(nfixedzeros != NULL);
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+   assert(consdata->watched);
+   assert(consdata->nfixedzeros == 0);
+
+   vars = consdata->vars;
+   nvars = consdata->nvars;
+
+   *nfixedzeros = 0;
+
+   /* if at least two variables are fixed to one, the number of variables fixed to zero is not needed */
+   if( consdata->nfixedones >= 2 )
+      return SCIP_OKAY;
+
+   /* if no variable is fixed to one, the number of variables fixed to zero is only needed if one of the watched
+    * variables is fixed to zero
+    */
+   if( consdata->nfixedones == 0 && consdata->watchedvar2 != -1
+      && SCIPvarGetUbLocal(vars[consdata->watchedvar1]) > 0.5 && SCIPvarGetUbLocal(vars[consdata->watchedvar2]) > 0.5 )
+      return SCIP_OKAY;
+
+   /* keep the watched variables that are not fixed to zero */
+   watchedvar1 = -1;
+   watchedvar2 = -1;
+   if( consdata->watchedvar1 != -1 && SCIPvarGetUbLocal(vars[consdata->watchedvar1]) > 0.5 )
+      watchedvar1 = consdata->watchedvar1;
+   if( consdata->watchedvar2 != -1 && SCIPvarGetUbLocal(vars[consdata->watchedvar2]) > 0.5 )
+   {
+      if( watchedvar1 == -1 )
+         watchedvar1 = consdata->watchedvar2;
+      else
+         watchedvar2 = consdata->watchedvar2;
+   }
+
+   /* count the variables fixed to zero and search for new watched variables */
+   for( v = 0; v < nvars; ++v )
+   {
+      if( SCIPvarGetUbLocal(vars[v]) < 0.5 )
+         ++(*nfixedzeros);
+      else if( watchedvar2 == -1 && v != watchedvar1 )
+      {
+         if( watchedvar1 == -1 )
+            watchedvar1 = v;
+         else
+            watchedvar2 = v;
+      }
+   }
+   assert(*nfixedzeros <= nvars);
+
+   /* if at least two variables are not fixed to zero, they become the watched variables; otherwise, the constraint is
+    * decided by processFixings() in the current subtree, and the old watched variables are kept
+    */
+   if( watchedvar2 != -1 )
+   {
+      conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+      assert(conshdlrdata != NULL);
+
+      SCIP_CALL( switchWatchedvars(scip, cons, conshdlrdata->eventhdlr, watchedvar1, watchedvar2) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** checks constraint for violation only looking at the fixed variables, applies further fixings if possible */
 static
 SCIP_RETCODE processFixings(
@@ -2177,6 +2492,7 @@ SCIP_RETCODE processFixings(
    )
 {
    SCIP_CONSDATA* consdata;
+   int nfixedzeros;
 #ifndef NDEBUG
    int oldnfixedvars;
 #endif
@@ -2203,8 +2519,16 @@ SCIP_RETCODE processFixings(
    *addcut = FALSE;
    *mustcheck = TRUE;
 
+   /* get the number of variables fixed to zero, which is only counted on demand if watched variables are used */
+   if( consdata->watched )
+   {
+      SCIP_CALL( processWatchedVars(scip, cons, &nfixedzeros) );
+   }
+   else
+      nfixedzeros = consdata->nfixedzeros;
+
    /*SCIPdebugMsg(scip, "processing constraint <%s> with respect to fixed variables (%d fixed to 0.0, %d fixed to 1.0)\n",
-     SCIPconsGetName(cons), consdata->nfixedzeros, consdata->nfixedones);*/
+     SCIPconsGetName(cons), nfixedzeros, consdata->nfixedones);*/
 
    if( consdata->nfixedones == 1 )
    {
@@ -2219,7 +2543,7 @@ SCIP_RETCODE processFixings(
       }
       else
       {
-         if( consdata->nfixedzeros < consdata->nvars - 1 )
+         if( nfixedzeros < consdata->nvars - 1 )
          {
             SCIP_VAR** vars;
             SCIP_VAR* var;
@@ -2308,7 +2632,7 @@ SCIP_RETCODE processFixings(
       }
       *mustcheck = FALSE;
    }
-   else if( consdata->nfixedzeros == consdata->nvars )
+   else if( nfixedzeros == consdata->nvars )
    {
       /* all variables are fixed to zero:
        * - a set packing constraint is feasible anyway, and if it's unmodifiable, it can be disabled
@@ -2343,7 +2667,7 @@ SCIP_RETCODE processFixings(
       }
       *mustcheck = FALSE;
    }
-   else if( consdata->nfixedzeros == consdata->nvars - 1 && consdata->nfixedones == 0 )
+   else if( nfixedzeros == consdata->nvars - 1 && consdata->nfixedones == 0 )
    {
       /* all variables except one are fixed to zero:
        * - a set packing constraint is feasible anyway, and if it's unmodifiable, it can be disabled
@@ -2390,7 +2714,7 @@ SCIP_RETCODE processFixings(
             }
          }
          assert(v < nvars);
-         assert(consdata->nfixedzeros == consdata->nvars - 1);
+         assert(nfixedzeros == consdata->nvars - 1);
          assert(consdata->nfixedones == 1);
 
          SCIP_CALL( SCIPdelConsLocal(scip, cons) );
@@ -7623,6 +7947,22 @@ SCIP_DECL_CONSEXITPRE(consExitpreSetppc)
 static
 SCIP_DECL_CONSINITSOL(consInitsolSetppc)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+   assert(conshdlrdata->eventhdlr != NULL);
+
+   /* only catch fixings to zero of two watched variables during the solving process */
+   if( conshdlrdata->watchedvars )
+   {
+      int c;
+      for( c = 0; c < nconss; ++c )
+      {
+         SCIP_CALL( setWatchedEvents(scip, conss[c], conshdlrdata->eventhdlr, TRUE) );
+      }
+   }
+
    /* add nlrow representation to NLP, if NLP had been constructed */
    if( SCIPisNLPConstructed(scip) )
    {
@@ -7640,15 +7980,22 @@ SCIP_DECL_CONSINITSOL(consInitsolSetppc)
 static
 SCIP_DECL_CONSEXITSOL(consExitsolSetppc)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata;
    int c;
 
-   /* release the rows and nlrows of all constraints */
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+   assert(conshdlrdata->eventhdlr != NULL);
+
+   /* release the rows and nlrows of all constraints, and count all fixings to zero again for presolving */
    for( c = 0; c < nconss; ++c )
    {
       consdata = SCIPconsGetData(conss[c]);
       assert(consdata != NULL);
 
+      SCIP_CALL( setWatchedEvents(scip, conss[c], conshdlrdata->eventhdlr, FALSE) );
+
       if( consdata->row != NULL )
       {
          SCIP_CALL( SCIPreleaseRow(scip, &consdata->row) );
@@ -8789,7 +9136,8 @@ SCIP_DECL_CONSACTIVE(consActiveSetppc)
       SCIP_CONSDATA* consdata = SCIPconsGetData(cons);
       assert(consdata != NULL);
 
-      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 )
+      /* constraints with watched variables are always processed to check their watched variables */
+      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 || consdata->watched )
       {
          SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
       }
@@ -9187,9 +9535,12 @@ SCIP_DECL_EVENTEXEC(eventExecSetppc)
       consdata->nfixedones--;
       break;
    case SCIP_EVENTTYPE_UBTIGHTENED:
-      consdata->nfixedzeros++;
+      /* if watched variables are used, this event is only caught for them, and the constraint has to be processed */
+      if( !consdata->watched )
+         consdata->nfixedzeros++;
       break;
    case SCIP_EVENTTYPE_UBRELAXED:
+      assert(!consdata->watched);
       consdata->nfixedzeros--;
       break;
    case SCIP_EVENTTYPE_VARDELETED:
@@ -9227,7 +9578,7 @@ SCIP_DECL_EVENTEXEC(eventExecSetppc)
 
    if( eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED )
    {
-      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 )
+      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 || consdata->watched )
       {
          consdata->presolpropagated = FALSE;
          SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
@@ -9428,6 +9779,7 @@ SCIP_RETCODE SCIPincludeConshdlrSetppc(
    SCIP_CALL( SCIPsetConshdlrPrint(scip, conshdlr, consPrintSetppc) );
    SCIP_CALL( SCIPsetConshdlrProp(scip, conshdlr, consPropSetppc, CONSHDLR_PROPFREQ, CONSHDLR_DELAYPROP,
          CONSHDLR_PROP_TIMING) );
+   SCIPconshdlrSetPropMarkedOnly(conshdlr, TRUE);
    SCIP_CALL( SCIPsetConshdlrResprop(scip, conshdlr, consRespropSetppc) );
    SCIP_CALL( SCIPsetConshdlrSepa(scip, conshdlr, consSepalpSetppc, consSepasolSetppc, CONSHDLR_SEPAFREQ,
          CONSHDLR_SEPAPRIORITY, CONSHDLR_DELAYSEPA) );
@@ -9482,6 +9834,10 @@ SCIP_RETCODE SCIPincludeConshdlrSetppc(
          "constraints/" CONSHDLR_NAME "/copytypedcons",
          "should setppc constraints be copied as setppc instead of as linear constraints?",
          &conshdlrdata->copytypedcons, TRUE, DEFAULT_COPYTYPEDCONS, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "constraints/" CONSHDLR_NAME "/watchedvars",
+         "should fixings to zero only be caught for two watched variables of each constraint during the solving process?",
+         &conshdlrdata->watchedvars, TRUE, DEFAULT_WATCHEDVARS, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -9875,6 +10231,21 @@ int SCIPgetNFixedzerosSetppc(
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
 
+   /* if watched variables are used, the variables fixed to zero are not counted */
+   if( consdata->watched )
+   {
+      int nfixedzeros = 0;
+      int v;
+
+      for( v = 0; v < consdata->nvars; ++v )
+      {
+         if( SCIPvarGetUbLocal(consdata->vars[v]) < 0.5 )
+            ++nfixedzeros;
+      }
+
+      return nfixedzeros;
+   }
+
    return consdata->nfixedzeros;
 }
 
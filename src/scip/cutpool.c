@@ -310,6 +310,115 @@ SCIP_RETCODE cutpoolEnsureCutsMem(
    return SCIP_OKAY;
 }
 
+/** ensures that the arrays of occurrence lists can store the lists of columns with index smaller than num */
+static
+SCIP_RETCODE cutpoolEnsureColcutsMem(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in arrays */
+   )
+{
+   assert(cutpool != NULL);
+   assert(set != NULL);
+
+   if( num > cutpool->colcutssize )
+   {
+      int newsize;
+      int i;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->colcuts, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->colcutnzs, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->ncolcuts, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->colcutssizes, newsize) );
+      for( i = cutpool->colcutssize; i < newsize; ++i )
+      {
+         cutpool->colcuts[i] = NULL;
+         cutpool->colcutnzs[i] = NULL;
+         cutpool->ncolcuts[i] = 0;
+         cutpool->colcutssizes[i] = 0;
+      }
+      cutpool->colcutssize = newsize;
+   }
+   assert(num <= cutpool->colcutssize);
+
+   return SCIP_OKAY;
+}
+
+/** stores the values of all columns in the current LP solution in the dense lpsolvals array of the cut pool and
+ *  invalidates the stored activities of all cuts containing a column whose value changed
+ */
+static
+SCIP_RETCODE cutpoolUpdateLPSolVals(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_Real* newvals;
+   int ncols;
+   int c;
+   int i;
+
+   assert(cutpool != NULL);
+   assert(stat != NULL);
+
+   /* the values are still valid if no LP was solved and no column was created in between */
+   if( cutpool->lpsolvalslp == stat->lpcount && cutpool->nlpsolvals == stat->ncolidx )
+      return SCIP_OKAY;
+
+   if( stat->ncolidx > cutpool->lpsolvalssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, stat->ncolidx);
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->lpsolvals, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->newlpsolvals, newsize) );
+      cutpool->lpsolvalssize = newsize;
+   }
+   assert(stat->ncolidx <= cutpool->lpsolvalssize);
+
+   /* columns created since the last update had value zero */
+   if( stat->ncolidx > cutpool->nlpsolvals )
+   {
+      BMSclearMemoryArray(&cutpool->lpsolvals[cutpool->nlpsolvals], stat->ncolidx - cutpool->nlpsolvals);
+   }
+
+   /* collect the new values; columns that are not in the LP have value zero */
+   newvals = cutpool->newlpsolvals;
+   BMSclearMemoryArray(newvals, stat->ncolidx);
+
+   cols = SCIPlpGetCols(lp);
+   ncols = SCIPlpGetNCols(lp);
+   for( c = 0; c < ncols; ++c )
+   {
+      assert(SCIPcolGetIndex(cols[c]) < stat->ncolidx);
+      assert(SCIPcolGetPrimsol(cols[c]) != SCIP_INVALID); /*lint !e777*/
+      newvals[SCIPcolGetIndex(cols[c])] = SCIPcolGetPrimsol(cols[c]);
+   }
+
+   /* only the cuts in the occurrence lists of changed columns need to recompute their activities */
+   for( i = 0; i < stat->ncolidx; ++i )
+   {
+      if( newvals[i] != cutpool->lpsolvals[i] ) /*lint !e777*/
+      {
+         if( i < cutpool->colcutssize )
+         {
+            for( c = 0; c < cutpool->ncolcuts[i]; ++c )
+               cutpool->colcuts[i][c]->validlpactivity = FALSE;
+         }
+         cutpool->lpsolvals[i] = newvals[i];
+      }
+   }
+
+   cutpool->lpsolvalslp = stat->lpcount;
+   cutpool->nlpsolvals = stat->ncolidx;
+
+   return SCIP_OKAY;
+}
+
 
 
 /*
@@ -335,6 +444,13 @@ SCIP_RETCODE cutCreate(
    (*cut)->processedlp = -1;
    (*cut)->processedlpsol = -1;
    (*cut)->pos = -1;
+   (*cut)->len = 0;
+   (*cut)->lpactivity = SCIP_INVALID;
+   (*cut)->hascopy = FALSE;
+   (*cut)->validlpactivity = FALSE;
+   (*cut)->colinds = NULL;
+   (*cut)->colvals = NULL;
+   (*cut)->colcutpos = NULL;
 
    /* capture row */
    SCIProwCapture(row);
@@ -360,11 +476,143 @@ SCIP_RETCODE cutFree(
    SCIP_CALL( SCIProwRelease(&(*cut)->row, blkmem, set, lp) );
 
    /* free cut memory */
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*cut)->colcutpos, (*cut)->len);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*cut)->colvals, (*cut)->len);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*cut)->colinds, (*cut)->len);
    BMSfreeBlockMemory(blkmem, cut);
 
    return SCIP_OKAY;
 }
 
+/** calculates the activity of the cut's row in the current LP solution from the LP solution values stored in the pool */
+static
+SCIP_Real cutCalcLPActivity(
+   SCIP_CUT*             cut,                /**< cut */
+   const SCIP_Real*      lpsolvals           /**< LP solution values of the columns, indexed by column index */
+   )
+{
+   const int* colinds;
+   const SCIP_Real* colvals;
+   SCIP_Real activity;
+   int i;
+
+   assert(cut != NULL);
+   assert(cut->hascopy);
+   assert(lpsolvals != NULL);
+
+   colinds = cut->colinds;
+   colvals = cut->colvals;
+   activity = cut->row->constant;
+
+   /* the contiguous layout avoids dereferencing the columns of the row */
+   for( i = 0; i < cut->len; ++i )
+      activity += colvals[i] * lpsolvals[colinds[i]];
+
+   return activity;
+}
+
+/** stores a copy of the nonzeros of the cut's row and inserts the cut into the occurrence lists of its columns
+ *
+ *  The copy stays valid since the row is locked while it is in the pool. It is only created for cuts whose activity is
+ *  computed from the LP solution values stored in the pool.
+ */
+static
+SCIP_RETCODE cutpoolLinkCut(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_CUT*             cut                 /**< cut to insert */
+   )
+{
+   SCIP_ROW* row;
+   int idx;
+   int pos;
+   int i;
+
+   assert(cutpool != NULL);
+   assert(cut != NULL);
+   assert(!cut->hascopy);
+
+   row = cut->row;
+   assert(row != NULL);
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &cut->colinds, row->len) );
+   SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &cut->colvals, row->vals, row->len) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &cut->colcutpos, row->len) );
+   for( i = 0; i < row->len; ++i )
+      cut->colinds[i] = SCIPcolGetIndex(row->cols[i]);
+   cut->len = row->len;
+   cut->hascopy = TRUE;
+   cut->validlpactivity = FALSE;
+
+   SCIP_CALL( cutpoolEnsureColcutsMem(cutpool, set, stat->ncolidx) );
+
+   for( i = 0; i < cut->len; ++i )
+   {
+      idx = cut->colinds[i];
+      assert(0 <= idx && idx < cutpool->colcutssize);
+
+      pos = cutpool->ncolcuts[idx];
+      if( pos == cutpool->colcutssizes[idx] )
+      {
+         int newsize;
+
+         newsize = SCIPsetCalcMemGrowSize(set, pos + 1);
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &cutpool->colcuts[idx], cutpool->colcutssizes[idx], newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &cutpool->colcutnzs[idx], cutpool->colcutssizes[idx], newsize) );
+         cutpool->colcutssizes[idx] = newsize;
+      }
+      assert(pos < cutpool->colcutssizes[idx]);
+
+      cutpool->colcuts[idx][pos] = cut;
+      cutpool->colcutnzs[idx][pos] = i;
+      cut->colcutpos[i] = pos;
+      cutpool->ncolcuts[idx]++;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** removes the cut from the occurrence lists of its columns */
+static
+void cutpoolUnlinkCut(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   SCIP_CUT*             cut                 /**< cut to remove */
+   )
+{
+   SCIP_CUT* movedcut;
+   int idx;
+   int pos;
+   int last;
+   int i;
+
+   assert(cutpool != NULL);
+   assert(cut != NULL);
+
+   if( !cut->hascopy )
+      return;
+
+   for( i = 0; i < cut->len; ++i )
+   {
+      idx = cut->colinds[i];
+      pos = cut->colcutpos[i];
+      assert(0 <= idx && idx < cutpool->colcutssize);
+      assert(0 <= pos && pos < cutpool->ncolcuts[idx]);
+      assert(cutpool->colcuts[idx][pos] == cut);
+
+      /* move the last entry of the occurrence list to the free position */
+      last = --cutpool->ncolcuts[idx];
+      if( pos < last )
+      {
+         movedcut = cutpool->colcuts[idx][last];
+         cutpool->colcuts[idx][pos] = movedcut;
+         cutpool->colcutnzs[idx][pos] = cutpool->colcutnzs[idx][last];
+         movedcut->colcutpos[cutpool->colcutnzs[idx][pos]] = pos;
+      }
+   }
+}
+
 /** returns whether the cut's age exceeds the age limit */
 static
 SCIP_Bool cutIsAged(
@@ -444,7 +692,18 @@ SCIP_RETCODE SCIPcutpoolCreate(
          hashGetKeyCut, hashKeyEqCut, hashKeyValCut, (void*) set) );
 
    (*cutpool)->cuts = NULL;
+   (*cutpool)->lpsolvals = NULL;
+   (*cutpool)->newlpsolvals = NULL;
+   (*cutpool)->colcuts = NULL;
+   (*cutpool)->colcutnzs = NULL;
+   (*cutpool)->ncolcuts = NULL;
+   (*cutpool)->colcutssizes = NULL;
+   (*cutpool)->colcutssize = 0;
    (*cutpool)->cutssize = 0;
+   (*cutpool)->lpsolvalssize = 0;
+   (*cutpool)->nlpsolvals = 0;
+   (*cutpool)->lpsolvalslp = -1;
+   (*cutpool)->nnonzeros = 0;
    (*cutpool)->ncuts = 0;
    (*cutpool)->nremovablecuts = 0;
    (*cutpool)->agelimit = agelimit;
@@ -472,6 +731,8 @@ SCIP_RETCODE SCIPcutpoolFree(
    SCIP_LP*              lp                  /**< current LP data */
    )
 {
+   int i;
+
    assert(cutpool != NULL);
    assert(*cutpool != NULL);
 
@@ -484,6 +745,18 @@ SCIP_RETCODE SCIPcutpoolFree(
    /* free hash table */
    SCIPhashtableFree(&(*cutpool)->hashtable);
 
+   /* free occurrence lists */
+   for( i = 0; i < (*cutpool)->colcutssize; ++i )
+   {
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*cutpool)->colcutnzs[i], (*cutpool)->colcutssizes[i]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*cutpool)->colcuts[i], (*cutpool)->colcutssizes[i]);
+   }
+   BMSfreeMemoryArrayNull(&(*cutpool)->colcutssizes);
+   BMSfreeMemoryArrayNull(&(*cutpool)->ncolcuts);
+   BMSfreeMemoryArrayNull(&(*cutpool)->colcutnzs);
+   BMSfreeMemoryArrayNull(&(*cutpool)->colcuts);
+   BMSfreeMemoryArrayNull(&(*cutpool)->newlpsolvals);
+   BMSfreeMemoryArrayNull(&(*cutpool)->lpsolvals);
    BMSfreeMemoryArrayNull(&(*cutpool)->cuts);
    BMSfreeMemory(cutpool);
 
@@ -514,6 +787,11 @@ SCIP_RETCODE SCIPcutpoolClear(
 
    cutpool->ncuts = 0;
    cutpool->nremovablecuts = 0;
+   cutpool->nnonzeros = 0;
+
+   /* empty occurrence lists */
+   for( i = 0; i < cutpool->colcutssize; ++i )
+      cutpool->ncolcuts[i] = 0;
 
    return SCIP_OKAY;
 }
@@ -566,6 +844,10 @@ SCIP_RETCODE cutpoolDelCut(
    /* unlock the row */
    SCIProwUnlock(cut->row);
 
+   cutpool->nnonzeros -= SCIProwGetNNonz(cut->row);
+   assert(cutpool->nnonzeros >= 0);
+   cutpoolUnlinkCut(cutpool, cut);
+
    /* free the cut */
    SCIP_CALL( cutFree(&cutpool->cuts[pos], blkmem, set, lp) );
 
@@ -767,6 +1049,7 @@ SCIP_RETCODE SCIPcutpoolAddNewRow(
    cutpool->cuts[cutpool->ncuts] = cut;
    cutpool->ncuts++;
    cutpool->ncutsfound++;
+   cutpool->nnonzeros += SCIProwGetNNonz(row);
    cutpool->maxncuts = MAX(cutpool->maxncuts, cutpool->ncuts);
    if( SCIProwIsRemovable(row) )
       cutpool->nremovablecuts++;
@@ -844,6 +1127,7 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    SCIP_Bool cutoff;
    SCIP_Real minefficacy;
    SCIP_Bool retest;
+   SCIP_Bool uselpsolvals;
    int firstunproc;
    int oldncutsadded;
    int oldncutsfound;
@@ -912,6 +1196,15 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    oldncutsadded = SCIPsepastoreGetNCutsAdded(sepastore);
    nefficaciouscuts = 0;
 
+   /* if enabled and the pool has more nonzeros than there are columns, compute the activities of the cuts from a dense
+    * copy of the LP solution; its setup is then cheaper than dereferencing the columns of all cuts
+    */
+   uselpsolvals = (set->sepa_compactcutpool && sol == NULL && cutpool->nnonzeros >= stat->ncolidx);
+   if( uselpsolvals )
+   {
+      SCIP_CALL( cutpoolUpdateLPSolVals(cutpool, set, stat, lp) );
+   }
+
    /* process all unprocessed cuts in the pool */
    cutoff = FALSE;
    for( c = firstunproc; c < cutpool->ncuts; ++c )
@@ -958,6 +1251,24 @@ SCIP_RETCODE SCIPcutpoolSeparate(
                continue;
             }
 
+            /* store the activity in the row, such that it is reused by the efficacy computation; the activity of the
+             * cut only needs to be recomputed if the LP solution value of one of its columns changed
+             */
+            if( uselpsolvals && row->validactivitylp != stat->lpcount )
+            {
+               if( !cut->hascopy )
+               {
+                  SCIP_CALL( cutpoolLinkCut(cutpool, blkmem, set, stat, cut) );
+               }
+               if( !cut->validlpactivity )
+               {
+                  cut->lpactivity = cutCalcLPActivity(cut, cutpool->lpsolvals);
+                  cut->validlpactivity = TRUE;
+               }
+               row->activity = cut->lpactivity;
+               row->validactivitylp = stat->lpcount;
+            }
+
             efficacy = sol == NULL ? SCIProwGetLPEfficacy(row, set, stat, lp) : SCIProwGetSolEfficacy(row, set, stat, sol);
             if( SCIPsetIsFeasPositive(set, efficacy) )
                ++nefficaciouscuts;
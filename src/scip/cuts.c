@@ -4097,6 +4097,8 @@ SCIP_Real SCIPaggrRowGetRhs(
  * variable bounds on variables of the same section to be used */
 
 #define NSECTIONS 6
+#define MIRDENSEFRAC             0.1 /**< minimal fraction of variables in an aggregation row to collect its non-zeros
+                                      *   by a pass over the dense coefficient array instead of sorting them */
 
 typedef struct MIR_Data
 {
@@ -4166,6 +4168,82 @@ int varSection(
    return 5;
 }
 
+/** initializes the working cut with the scaled aggregation row and adds its variables to their sections
+ *
+ *  The sections are filled in decreasing order of the problem indices. If the aggregation row contains a large fraction
+ *  of the problem variables, the non-zeros are collected by one pass over its dense coefficient array, which already
+ *  yields this order, instead of sorting the index array of the aggregation row.
+ */
+static
+void mirDataInitCut(
+   MIR_DATA*             data,               /**< The MIR separation data */
+   SCIP_AGGRROW*         aggrrow,            /**< the aggregation row to initialize the cut with */
+   SCIP_Real             scale               /**< scale factor to apply to the aggregation row */
+   )
+{
+   int nnz;
+   int l;
+
+   assert(data != NULL);
+   assert(aggrrow != NULL);
+   assert(aggrrow->nnz <= data->nvars);
+
+   nnz = aggrrow->nnz;
+
+   if( nnz == 0 )
+      return;
+
+   if( nnz >= MIRDENSEFRAC * data->nvars )
+   {
+      int ncutinds = 0;
+
+      for( l = data->nvars - 1; l >= 0; --l )
+      {
+         SCIP_Real QUAD(coef);
+
+         QUAD_ARRAY_LOAD(coef, aggrrow->vals, l);
+
+         if( QUAD_HI(coef) == 0.0 )
+            continue;
+
+         SCIPquadprecProdQD(coef, coef, scale);
+
+         QUAD_ARRAY_STORE(data->cutcoefs, l, coef);
+         data->cutinds[ncutinds++] = l;
+      }
+      assert(ncutinds == nnz);
+   }
+   else
+   {
+      BMScopyMemoryArray(data->cutinds, aggrrow->inds, nnz);
+
+      for( l = 0; l < nnz; ++l )
+      {
+         SCIP_Real QUAD(coef);
+         int m = aggrrow->inds[l];
+
+         QUAD_ARRAY_LOAD(coef, aggrrow->vals, m);
+
+         SCIPquadprecProdQD(coef, coef, scale);
+
+         QUAD_ARRAY_STORE(data->cutcoefs, m, coef);
+
+         assert(QUAD_HI(coef) != 0.0);
+      }
+
+      /* sort the array by problem index */
+      SCIPsortDownInt(data->cutinds, nnz);
+   }
+
+   /* add the variables to their sections */
+   for( l = 0; l < nnz; ++l )
+   {
+      int section = varSection(data, data->cutinds[l]);
+      data->secindices[section][data->secnnz[section]] = data->cutinds[l];
+      ++data->secnnz[section];
+   }
+}
+
 /** finds the best lower bound of the variable to use for MIR transformation.
  *
  *  Currently, we use a slightly different function for the exact MIR cuts than for the normal MIR cuts due to differences
@@ -8024,34 +8102,8 @@ SCIP_RETCODE SCIPcalcMIR(
 
    SCIPquadprecProdQD(data->cutrhs, aggrrow->rhs, scale);
 
-   if( nnz > 0 )
-   {
-      /* Initalize cut with the aggregation */
-      BMScopyMemoryArray(data->cutinds, aggrrow->inds, nnz);
-
-      for( l = 0; l < nnz; ++l )
-      {
-         SCIP_Real QUAD(coef);
-         int m = aggrrow->inds[l];
-
-         QUAD_ARRAY_LOAD(coef, aggrrow->vals, m);
-
-         SCIPquadprecProdQD(coef, coef, scale);
-
-         QUAD_ARRAY_STORE(data->cutcoefs, m, coef);
-
-         assert(QUAD_HI(coef) != 0.0);
-      }
-
-      /* Sort the array by problem index and add the variables to their sections */
-      SCIPsortDownInt(data->cutinds, nnz);
-      for( l = 0; l < nnz; ++l )
-      {
-         int section = varSection(data, data->cutinds[l]);
-         data->secindices[section][data->secnnz[section]] = data->cutinds[l];
-         ++data->secnnz[section];
-      }
-   }
+   /* initialize cut with the aggregation */
+   mirDataInitCut(data, aggrrow, scale);
 
    SCIPdebugMsg(scip, "Initial row:\n");
    SCIPdebug( printCutQuad(scip, sol, data->cutcoefs, QUAD(data->cutrhs), data->cutinds, nnz, FALSE, FALSE) );
@@ -8468,34 +8520,8 @@ SCIP_RETCODE SCIPcutGenerationHeuristicCMIR(
 
       SCIPquadprecProdQD(data->cutrhs, aggrrow->rhs, 1.0);
 
-      if( nnz > 0 )
-      {
-         /* Initalize cut with the aggregation */
-         BMScopyMemoryArray(data->cutinds, aggrrow->inds, nnz);
-
-         for( l = 0; l < nnz; ++l )
-         {
-            SCIP_Real QUAD(coef);
-            int m = aggrrow->inds[l];
-
-            QUAD_ARRAY_LOAD(coef, aggrrow->vals, m);
-
-            SCIPquadprecProdQD(coef, coef, 1.0);
-
-            QUAD_ARRAY_STORE(data->cutcoefs, m, coef);
-
-            assert(QUAD_HI(coef) != 0.0);
-         }
-
-         /* Sort the array by problem index and add the variables to their sections */
-         SCIPsortDownInt(data->cutinds, nnz);
-         for( l = 0; l < nnz; ++l )
-         {
-            int section = varSection(data, data->cutinds[l]);
-            data->secindices[section][data->secnnz[section]] = data->cutinds[l];
-            ++data->secnnz[section];
-         }
-      }
+      /* initialize cut with the aggregation */
+      mirDataInitCut(data, aggrrow, 1.0);
 
       data->ncutinds = 0;
    }
@@ -13415,34 +13441,8 @@ SCIP_RETCODE SCIPcalcStrongCG(
 
    SCIPquadprecProdQD(data->cutrhs, aggrrow->rhs, scale);
 
-   if( nnz > 0 )
-   {
-      /* Initalize cut with the aggregation */
-      BMScopyMemoryArray(data->cutinds, aggrrow->inds, nnz);
-
-      for( l = 0; l < nnz; ++l )
-      {
-         SCIP_Real QUAD(coef);
-         int m = aggrrow->inds[l];
-
-         QUAD_ARRAY_LOAD(coef, aggrrow->vals, m);
-
-         SCIPquadprecProdQD(coef, coef, scale);
-
-         QUAD_ARRAY_STORE(data->cutcoefs, m, coef);
-
-         assert(QUAD_HI(coef) != 0.0);
-      }
-
-      /* Sort the array by problem index and add the variables to their sections */
-      SCIPsortDownInt(data->cutinds, nnz);
-      for( l = 0; l < nnz; ++l )
-      {
-         int section = varSection(data, data->cutinds[l]);
-         data->secindices[section][data->secnnz[section]] = data->cutinds[l];
-         ++data->secnnz[section];
-      }
-   }
+   /* initialize cut with the aggregation */
+   mirDataInitCut(data, aggrrow, scale);
 
    data->ncutinds = 0;
    *cutislocal = aggrrow->local;
@@ -355,22 +355,23 @@ void selectBestCut(
  *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
 static
 int filterWithParallelism(
-   SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   SCIP_Real*            parallelisms,       /**< array with parallelisms of cuts to the cut to filter orthogonality with */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             maxparallel         /**< maximal parallelism for all cuts that are not good */
    )
 {
-   assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( ncuts == 0 || parallelisms != NULL );
 
+   /* the parallelisms need not be swapped, since positions behind i are not visited anymore */
    for( int i = ncuts - 1; i >= 0; --i )
    {
       SCIP_Real thisparallel;
 
-      thisparallel = SCIProwGetParallelism(cut, cuts[i], 'e');
+      thisparallel = parallelisms[i];
 
       if( thisparallel > maxparallel )
       {
@@ -387,23 +388,24 @@ int filterWithParallelism(
 static
 int penaliseWithParallelism(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   SCIP_Real*            parallelisms,       /**< array with parallelisms of cuts to the cut to filter orthogonality with */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             maxparallel,        /**< maximal parallelism for all cuts that are not good */
    SCIP_Real             paralpenalty        /**< penalty for weaker of two parallel cuts if penalising parallel cuts */
    )
 {
-   assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( ncuts == 0 || parallelisms != NULL );
 
+   /* the parallelisms need not be swapped, since positions behind i are not visited anymore */
    for( int i = ncuts - 1; i >= 0; --i )
    {
       SCIP_Real thisparallel;
 
-      thisparallel = SCIProwGetParallelism(cut, cuts[i], 'e');
+      thisparallel = parallelisms[i];
 
       /* Filter cuts that are absolutely parallel still. Otherwise penalise if closely parallel */
       if( thisparallel > 1 - SCIPsumepsilon(scip) )
@@ -691,6 +693,7 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
 {
    SCIP_Real* scores;
    SCIP_Real* origscoresptr;
+   SCIP_Real* parallelisms;
    SCIP_Real nonzerobudget;
    SCIP_Real budgettaken = 0.0;
    SCIP_Real ncols;
@@ -712,6 +715,7 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
 
    /* Initialise the score array */
    SCIP_CALL( SCIPallocBufferArray(scip, &scores, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parallelisms, ncuts) );
    origscoresptr = scores;
 
    /* compute scores of cuts */
@@ -722,10 +726,15 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    /* forced cuts are going to be selected so use them to filter cuts */
    for( int i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
+      if( !cutseldata->filterparalcuts && !cutseldata->penaliseparalcuts )
+         break;
+
+      SCIP_CALL( SCIPgetRowParallelisms(scip, forcedcuts[i], cuts, ncuts, parallelisms) );
+
       if( cutseldata->filterparalcuts )
-         ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, cutseldata->maxparal);
-      else if( cutseldata->penaliseparalcuts )
-         ncuts = penaliseWithParallelism(scip, forcedcuts[i], cuts, scores, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+         ncuts = filterWithParallelism(cuts, scores, parallelisms, ncuts, cutseldata->maxparal);
+      else
+         ncuts = penaliseWithParallelism(scip, cuts, scores, parallelisms, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
    }
 
    /* Get the budget depending on if we are the root or not */
@@ -757,16 +766,22 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
       ++scores;
       --ncuts;
 
-      if( cutseldata->filterparalcuts && ncuts > 0)
-         ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, cutseldata->maxparal);
-      else if( cutseldata->penaliseparalcuts && ncuts > 0 )
-         ncuts = penaliseWithParallelism(scip, selectedcut, cuts, scores, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+      if( (cutseldata->filterparalcuts || cutseldata->penaliseparalcuts) && ncuts > 0 )
+      {
+         SCIP_CALL( SCIPgetRowParallelisms(scip, selectedcut, cuts, ncuts, parallelisms) );
+
+         if( cutseldata->filterparalcuts )
+            ncuts = filterWithParallelism(cuts, scores, parallelisms, ncuts, cutseldata->maxparal);
+         else
+            ncuts = penaliseWithParallelism(scip, cuts, scores, parallelisms, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+      }
 
       /* Filter out all remaining cuts that would go over the non-zero budget threshold */
       if( nonzerobudget - budgettaken < 1 && ncuts > 0 )
          ncuts = filterWithDensity(scip, cuts, nonzerobudget - budgettaken, ncuts);
    }
 
+   SCIPfreeBufferArray(scip, &parallelisms);
    SCIPfreeBufferArray(scip, &origscoresptr);
 
    return SCIP_OKAY;
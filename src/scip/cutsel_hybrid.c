@@ -230,9 +230,9 @@ void selectBestCut(
  *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
 static
 int filterWithParallelism(
-   SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   SCIP_Real*            parallelisms,       /**< array with parallelisms of cuts to the cut to filter orthogonality with */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             goodscore,          /**< threshold for the score to be considered a good cut */
    SCIP_Real             goodmaxparall,      /**< maximal parallelism for good cuts */
@@ -241,16 +241,17 @@ int filterWithParallelism(
 {
    int i;
 
-   assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( ncuts == 0 || parallelisms != NULL );
 
+   /* the parallelisms need not be swapped, since positions behind i are not visited anymore */
    for( i = ncuts - 1; i >= 0; --i )
    {
       SCIP_Real thisparall;
       SCIP_Real thismaxparall;
 
-      thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
+      thisparall = parallelisms[i];
       thismaxparall = scores[i] >= goodscore ? goodmaxparall : maxparall;
 
       if( thisparall > thismaxparall )
@@ -457,6 +458,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
 {
    SCIP_Real* scores;
    SCIP_Real* scoresptr;
+   SCIP_Real* parallelisms;
    SCIP_Real maxforcedscores;
    SCIP_Real maxnonforcedscores;
    SCIP_Real goodscore;
@@ -470,6 +472,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    *nselectedcuts = 0;
 
    SCIP_CALL( SCIPallocBufferArray(scip, &scores, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parallelisms, ncuts) );
 
    /* compute scores of cuts and max score of cuts and forced cuts (used to define goodscore) */
    maxforcedscores = scoring(scip, forcedcuts, randnumgen, dircutoffdistweight, efficacyweight, objparalweight, intsupportweight, nforcedcuts, NULL);
@@ -486,7 +489,8 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    /* forced cuts are going to be selected so use them to filter cuts */
    for( i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
-      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      SCIP_CALL( SCIPgetRowParallelisms(scip, forcedcuts[i], cuts, ncuts, parallelisms) );
+      ncuts = filterWithParallelism(cuts, scores, parallelisms, ncuts, goodscore, goodmaxparall, maxparall);
    }
 
    /* now greedily select the remaining cuts */
@@ -513,9 +517,11 @@ SCIP_RETCODE SCIPselectCutsHybrid(
       ++scores;
       --ncuts;
 
-      ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      SCIP_CALL( SCIPgetRowParallelisms(scip, selectedcut, cuts, ncuts, parallelisms) );
+      ncuts = filterWithParallelism(cuts, scores, parallelisms, ncuts, goodscore, goodmaxparall, maxparall);
    }
 
+   SCIPfreeBufferArray(scip, &parallelisms);
    SCIPfreeBufferArray(scip, &scoresptr);
 
    return SCIP_OKAY;
@@ -32,11 +32,14 @@
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
 
 #include "scip/pub_fileio.h"
 
 
 #define BUFFER_LEN 8192
+#define READBUFFER_LEN 131072                /**< size of the i/o buffer for files opened for reading; the readers
+                                              *   parse files line by line, so a large buffer saves system calls */
 
 #ifdef SCIP_WITH_ZLIB
 
@@ -45,7 +48,16 @@
 
 SCIP_FILE* SCIPfopen(const char *path, const char *mode)
 {
-   return (SCIP_FILE*)gzopen(path, mode);
+   gzFile file;
+
+   file = gzopen(path, mode);
+
+#if ZLIB_VERNUM >= 0x1240
+   if( file != NULL && strchr(mode, 'r') != NULL )
+      (void) gzbuffer(file, READBUFFER_LEN);
+#endif
+
+   return (SCIP_FILE*)file;
 }
 
 SCIP_FILE* SCIPfdopen(int fildes, const char *mode)
@@ -152,7 +164,14 @@ int SCIPfclose(SCIP_FILE *fp)
 
 SCIP_FILE* SCIPfopen(const char *path, const char *mode)
 {
-   return (SCIP_FILE*)fopen(path, mode);
+   FILE* file;
+
+   file = fopen(path, mode);
+
+   if( file != NULL && strchr(mode, 'r') != NULL )
+      (void) setvbuf(file, NULL, _IOFBF, READBUFFER_LEN);
+
+   return (SCIP_FILE*)file;
 }
 
 SCIP_FILE* SCIPfdopen(int fildes, const char *mode)
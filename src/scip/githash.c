@@ -0,0 +1 @@
+#define SCIP_GITHASH "954c36b-dirty"
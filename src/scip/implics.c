@@ -1328,6 +1328,58 @@ void SCIPcliqueDelVar(
 #endif
 }
 
+/** returns the first position in the sorted array of clique ids, starting from the given position, whose id is not
+ *  smaller than the given id, or the number of ids if there is no such position
+ *
+ *  The position is located by an exponential search followed by a binary search, such that the effort only depends
+ *  logarithmically on the distance to the start position. This makes repeated searches with increasing ids, e.g., when
+ *  intersecting a short with a long clique list, cheaper than a scan through the long list.
+ */
+static
+int cliqueidsSearch(
+   const unsigned int*   ids,                /**< sorted array of clique ids */
+   int                   first,              /**< position to start the search from */
+   int                   nids,               /**< number of ids in the array */
+   unsigned int          id                  /**< clique id to search for */
+   )
+{
+   int left;
+   int right;
+   int step;
+
+   assert(ids != NULL || nids == 0);
+   assert(0 <= first && first <= nids);
+
+   /* find a range (left,right] containing the searched position, where ids[left] < id holds */
+   left = first - 1;
+   right = first;
+   step = 1;
+   while( right < nids && ids[right] < id ) /*lint !e613*/
+   {
+      left = right;
+      right += step;
+      step *= 2;
+   }
+   right = MIN(right, nids);
+
+   /* binary search in the range */
+   while( left < right - 1 )
+   {
+      int middle;
+
+      middle = left + (right - left) / 2;
+      if( ids[middle] < id ) /*lint !e613*/
+         left = middle;
+      else
+         right = middle;
+   }
+   assert(right == nids || ids[right] >= id); /*lint !e613*/
+   assert(right == first || ids[right - 1] < id); /*lint !e613*/
+
+   return right;
+}
+
+#ifdef SCIP_MORE_DEBUG
 /** gets the position of the given clique in the cliques array; returns -1 if clique is not member of cliques array */
 static
 int cliquesSearchClique(
@@ -1368,7 +1420,6 @@ int cliquesSearchClique(
    return -1;
 }
 
-#ifdef SCIP_MORE_DEBUG
 /** checks whether clique appears in all clique lists of the involved variables */
 static
 void cliqueCheck(
@@ -1429,6 +1480,8 @@ SCIP_RETCODE cliquelistCreate(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, cliquelist) );
    (*cliquelist)->cliques[0] = NULL;
    (*cliquelist)->cliques[1] = NULL;
+   (*cliquelist)->ids[0] = NULL;
+   (*cliquelist)->ids[1] = NULL;
    (*cliquelist)->ncliques[0] = 0;
    (*cliquelist)->ncliques[1] = 0;
    (*cliquelist)->size[0] = 0;
@@ -1449,6 +1502,8 @@ void SCIPcliquelistFree(
    {
       BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->cliques[0], (*cliquelist)->size[0]);
       BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->cliques[1], (*cliquelist)->size[1]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->ids[0], (*cliquelist)->size[0]);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*cliquelist)->ids[1], (*cliquelist)->size[1]);
       BMSfreeBlockMemory(blkmem, cliquelist);
    }
 }
@@ -1471,6 +1526,7 @@ SCIP_RETCODE cliquelistEnsureSize(
 
       newsize = SCIPsetCalcMemGrowSize(set, num);
       SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &cliquelist->cliques[value], cliquelist->size[value], newsize) ); /*lint !e866*/
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &cliquelist->ids[value], cliquelist->size[value], newsize) ); /*lint !e866*/
       cliquelist->size[value] = newsize;
    }
    assert(num <= cliquelist->size[value]);
@@ -1504,9 +1560,9 @@ SCIP_RETCODE SCIPcliquelistAdd(
    {
       if( (*cliquelist)->cliques[value] != NULL )
       {
-         for( i = (*cliquelist)->ncliques[value]; i > 0 && (*cliquelist)->cliques[value][i - 1]->id > id; --i ); /*lint !e574 !e722*/
+         for( i = (*cliquelist)->ncliques[value]; i > 0 && (*cliquelist)->ids[value][i - 1] > id; --i ); /*lint !e574 !e722*/
          /* do not put the same clique twice in the cliquelist */
-         if( i > 0 && (*cliquelist)->cliques[value][i - 1]->id == id )
+         if( i > 0 && (*cliquelist)->ids[value][i - 1] == id )
             return SCIP_OKAY;
       }
    }
@@ -1516,8 +1572,10 @@ SCIP_RETCODE SCIPcliquelistAdd(
       clique->id, (void*)*cliquelist, value, (*cliquelist)->ncliques[value]);
 
    BMSmoveMemoryArray(&((*cliquelist)->cliques[value][i+1]), &((*cliquelist)->cliques[value][i]), (*cliquelist)->ncliques[value] - i); /*lint !e866*/
+   BMSmoveMemoryArray(&((*cliquelist)->ids[value][i+1]), &((*cliquelist)->ids[value][i]), (*cliquelist)->ncliques[value] - i); /*lint !e866*/
 
    (*cliquelist)->cliques[value][i] = clique;
+   (*cliquelist)->ids[value][i] = id;
    (*cliquelist)->ncliques[value]++;
 
    return SCIP_OKAY;
@@ -1543,10 +1601,10 @@ SCIP_RETCODE SCIPcliquelistDel(
    SCIPdebugMessage("deleting clique %u from cliquelist %p value %u (length: %d)\n",
       clique->id, (void*)*cliquelist, value, (*cliquelist)->ncliques[value]);
 
-   pos = cliquesSearchClique((*cliquelist)->cliques[value], (*cliquelist)->ncliques[value], clique);
+   pos = cliqueidsSearch((*cliquelist)->ids[value], 0, (*cliquelist)->ncliques[value], clique->id); /*lint !e732*/
 
    /* clique does not exist in cliquelist, the clique should contain multiple entries of the same variable */
-   if( pos < 0 )
+   if( pos == (*cliquelist)->ncliques[value] || (*cliquelist)->ids[value][pos] != clique->id )
    {
 #ifdef SCIP_MORE_DEBUG
       SCIP_VAR** clqvars;
@@ -1590,6 +1648,8 @@ SCIP_RETCODE SCIPcliquelistDel(
    {
       BMSmoveMemoryArray(&((*cliquelist)->cliques[value][pos]), &((*cliquelist)->cliques[value][pos+1]),
          (*cliquelist)->ncliques[value] - pos); /*lint !e866*/
+      BMSmoveMemoryArray(&((*cliquelist)->ids[value][pos]), &((*cliquelist)->ids[value][pos+1]),
+         (*cliquelist)->ncliques[value] - pos); /*lint !e866*/
    }
 
    /* free cliquelist if it is empty */
@@ -1599,6 +1659,8 @@ SCIP_RETCODE SCIPcliquelistDel(
    return SCIP_OKAY;
 }
 
+#define CLIQUELIST_SEARCHRATIO 8 /**< minimal length ratio of two clique lists to intersect them by searches */
+
 /** returns whether the given clique lists have a non-empty intersection, i.e. whether there is a clique that appears
  *  in both lists
  */
@@ -1609,73 +1671,72 @@ SCIP_Bool SCIPcliquelistsHaveCommonClique(
    SCIP_Bool             value2              /**< value of second variable */
    )
 {
-   SCIP_CLIQUE** cliques1;
-   SCIP_CLIQUE** cliques2;
-   int ncliques1;
-   int ncliques2;
+   unsigned int* ids1;
+   unsigned int* ids2;
+   int nids1;
+   int nids2;
    int i1;
    int i2;
 
    if( cliquelist1 == NULL || cliquelist2 == NULL )
       return FALSE;
 
-   ncliques1 = cliquelist1->ncliques[value1];
-   cliques1 = cliquelist1->cliques[value1];
-   ncliques2 = cliquelist2->ncliques[value2];
-   cliques2 = cliquelist2->cliques[value2];
+   nids1 = cliquelist1->ncliques[value1];
+   ids1 = cliquelist1->ids[value1];
+   nids2 = cliquelist2->ncliques[value2];
+   ids2 = cliquelist2->ids[value2];
 
-   i1 = 0;
-   i2 = 0;
+   if( nids1 == 0 || nids2 == 0 )
+      return FALSE;
 
-   if( i1 < ncliques1 && i2 < ncliques2 )
+   /* make the longer list the first one */
+   if( nids2 > nids1 )
    {
-      unsigned int cliqueid;
+      unsigned int* tmpids;
+      int tmpn;
 
-      /* make the bigger clique the first one */
-      if( ncliques2 > ncliques1 )
-      {
-         SCIP_CLIQUE** tmpc;
-         int tmpi;
-
-         tmpc = cliques1;
-         tmpi = ncliques1;
-         cliques1 = cliques2;
-         ncliques1 = ncliques2;
-         cliques2 = tmpc;
-         ncliques2 = tmpi;
-      }
-
-      /* check whether both clique lists have a same clique */
-      while( TRUE )  /*lint !e716*/
-      {
-         cliqueid = SCIPcliqueGetId(cliques2[i2]);
+      tmpids = ids1;
+      tmpn = nids1;
+      ids1 = ids2;
+      nids1 = nids2;
+      ids2 = tmpids;
+      nids2 = tmpn;
+   }
 
-         /* if last item in clique1 has a smaller index than the actual clique in clique2, than cause of increasing order
-          * there will be no same item and we can stop */
-         if( SCIPcliqueGetId(cliques1[ncliques1 - 1]) < cliqueid )
-            break;
+   /* because of the increasing order, there is no common clique if the ranges of ids do not overlap */
+   if( ids1[nids1 - 1] < ids2[0] || ids2[nids2 - 1] < ids1[0] )
+      return FALSE;
 
-         while( SCIPcliqueGetId(cliques1[i1]) < cliqueid )
-         {
-            ++i1;
-            assert(i1 < ncliques1);
-         }
-         cliqueid = SCIPcliqueGetId(cliques1[i1]);
+   i1 = 0;
+   i2 = 0;
 
-         /* if last item in clique2 has a smaller index than the actual clique in clique1, than cause of increasing order
-          * there will be no same item and we can stop */
-         if( SCIPcliqueGetId(cliques2[ncliques2 - 1]) < cliqueid )
-            break;
+   /* if the first list is much longer, search the ids of the second list in the first one instead of scanning it */
+   if( nids1 > CLIQUELIST_SEARCHRATIO * nids2 )
+   {
+      for( i2 = 0; i2 < nids2; ++i2 )
+      {
+         i1 = cliqueidsSearch(ids1, i1, nids1, ids2[i2]);
 
-         while( SCIPcliqueGetId(cliques2[i2]) < cliqueid )
-         {
-            ++i2;
-            assert(i2 < ncliques2);
-         }
-         if( SCIPcliqueGetId(cliques2[i2]) == cliqueid )
+         if( i1 == nids1 )
+            return FALSE;
+         if( ids1[i1] == ids2[i2] )
             return TRUE;
       }
+
+      return FALSE;
+   }
+
+   /* check whether both clique lists have a same clique */
+   while( i1 < nids1 && i2 < nids2 )
+   {
+      if( ids1[i1] < ids2[i2] )
+         ++i1;
+      else if( ids1[i1] > ids2[i2] )
+         ++i2;
+      else
+         return TRUE;
    }
+
    return FALSE;
 }
 
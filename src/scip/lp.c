@@ -8027,6 +8027,84 @@ SCIP_Real SCIProwGetParallelism(
    return parallelism;
 }
 
+/** computes the euclidean parallelism p = |v*w|/(|v|*|w|) between a row v and each row w of the given array, which
+ *  equals SCIProwGetParallelism() with orthofunc 'e'; as in SCIProwGetScalarProduct() and the row norms, only columns
+ *  that are currently in the LP contribute, for rows in and not in the LP alike; the first row is scattered into a
+ *  dense array once, such that each scalar product only needs a single pass over the nonzeros of the other row
+ */
+SCIP_RETCODE SCIProwGetParallelisms(
+   SCIP_ROW*             row,                /**< LP row */
+   SCIP_ROW**            rows,               /**< LP rows to compute the parallelism with */
+   int                   nrows,              /**< number of rows in the array */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_Real*            parallelisms        /**< array to store the parallelisms of the rows */
+   )
+{
+   SCIP_Real* densevals;
+   SCIP_Real scalarprod;
+   SCIP_Real norm;
+   int r;
+   int i;
+
+   assert(row != NULL);
+   assert(rows != NULL || nrows == 0);
+   assert(parallelisms != NULL || nrows == 0);
+   assert(stat != NULL);
+
+   if( nrows == 0 )
+      return SCIP_OKAY;
+
+   /* scatter the coefficients of the LP columns of the row; only they contribute to the scalar products, and adding up
+    * the coefficients handles rows that are not merged yet
+    */
+   SCIP_CALL( SCIPsetAllocCleanBufferArray(set, &densevals, stat->ncolidx) );
+   for( i = 0; i < row->len; ++i )
+   {
+      assert(row->cols_index[i] == row->cols[i]->index);
+      assert(row->cols_index[i] < stat->ncolidx);
+
+      if( row->cols[i]->lppos >= 0 )
+         densevals[row->cols_index[i]] += row->vals[i];
+   }
+
+   norm = SCIProwGetNorm(row);
+
+   for( r = 0; r < nrows; ++r )
+   {
+      SCIP_ROW* otherrow;
+      const int* colsindex;
+      const SCIP_Real* vals;
+
+      otherrow = rows[r];
+      assert(otherrow != NULL);
+
+      colsindex = otherrow->cols_index;
+      vals = otherrow->vals;
+      scalarprod = 0.0;
+      for( i = 0; i < otherrow->len; ++i )
+         scalarprod += vals[i] * densevals[colsindex[i]];
+
+      if( scalarprod == 0.0 )
+         parallelisms[r] = 0.0;
+      /* let SCIProwGetParallelism() repair norms that are wrongly zero */
+      else if( norm == 0.0 || SCIProwGetNorm(otherrow) == 0.0 )
+      {
+         parallelisms[r] = SCIProwGetParallelism(row, otherrow, 'e');
+         norm = SCIProwGetNorm(row);
+      }
+      else
+         parallelisms[r] = REALABS(scalarprod) / (norm * SCIProwGetNorm(otherrow));
+   }
+
+   /* clean the dense array */
+   for( i = 0; i < row->len; ++i )
+      densevals[row->cols_index[i]] = 0.0;
+   SCIPsetFreeCleanBufferArray(set, &densevals);
+
+   return SCIP_OKAY;
+}
+
 /** returns the degree of orthogonality between the hyperplanes defined by the two row vectors v, w:
  *  o = 1 - |v*w|/(|v|*|w|);
  *  the hyperplanes are orthogonal, iff p = 1, they are parallel, iff p = 0
@@ -8188,6 +8266,7 @@ SCIP_RETCODE lpFlushDelCols(
       assert(!lp->diving);
       SCIPdebugMessage("flushing col deletions: shrink LP from %d to %d columns\n", lp->nlpicols, lp->lpifirstchgcol);
       SCIP_CALL( SCIPlpiDelCols(lp->lpi, lp->lpifirstchgcol, lp->nlpicols-1) );
+      lp->nflushlpicalls++;
       for( i = lp->lpifirstchgcol; i < lp->nlpicols; ++i )
       {
          markColDeleted(lp->lpicols[i]);
@@ -8379,6 +8458,7 @@ SCIP_RETCODE lpFlushAddCols(
    /* call LP interface */
    SCIPsetDebugMsg(set, "flushing col additions: enlarge LP from %d to %d columns\n", lp->nlpicols, lp->ncols);
    SCIP_CALL( SCIPlpiAddCols(lp->lpi, naddcols, obj, lb, ub, name, nnonz, beg, ind, val) );
+   lp->nflushlpicalls++;
    lp->nlpicols = lp->ncols;
    lp->lpifirstchgcol = lp->nlpicols;
 
@@ -8449,6 +8529,7 @@ SCIP_RETCODE lpFlushDelRows(
 
       SCIPsetDebugMsg(set, "flushing row deletions: shrink LP from %d to %d rows\n", lp->nlpirows, lp->lpifirstchgrow);
       SCIP_CALL( SCIPlpiDelRows(lp->lpi, lp->lpifirstchgrow, lp->nlpirows-1) );
+      lp->nflushlpicalls++;
       for( i = lp->lpifirstchgrow; i < lp->nlpirows; ++i )
       {
          markRowDeleted(lp->lpirows[i]);
@@ -8594,6 +8675,7 @@ SCIP_RETCODE lpFlushAddRows(
    /* call LP interface */
    SCIPsetDebugMsg(set, "flushing row additions: enlarge LP from %d to %d rows\n", lp->nlpirows, lp->nrows);
    SCIP_CALL( SCIPlpiAddRows(lp->lpi, naddrows, lhs, rhs, name, nnonz, beg, ind, val) );
+   lp->nflushlpicalls++;
    lp->nlpirows = lp->nrows;
    lp->lpifirstchgrow = lp->nlpirows;
 
@@ -8646,12 +8728,12 @@ SCIP_RETCODE lpFlushChgCols(
    /* get the solver's infinity value */
    lpiinf = SCIPlpiInfinity(lp->lpi);
 
-   /* get temporary memory for changes */
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &objind, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdind, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, lp->ncols) );
+   /* get temporary memory for changes; each cached column yields at most one objective and one bound change */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &objind, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdind, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, lp->nchgcols) );
 
    /* collect all cached bound and objective changes */
    nobjchg = 0;
@@ -8691,7 +8773,7 @@ SCIP_RETCODE lpFlushChgCols(
             newobj = col->obj;
             if( col->flushedobj != newobj ) /*lint !e777*/
             {
-               assert(nobjchg < lp->ncols);
+               assert(nobjchg < lp->nchgcols);
                objind[nobjchg] = col->lpipos;
                obj[nobjchg] = newobj;
                nobjchg++;
@@ -8710,7 +8792,7 @@ SCIP_RETCODE lpFlushChgCols(
 
             if( col->flushedlb != newlb || col->flushedub != newub ) /*lint !e777*/
             {
-               assert(nbdchg < lp->ncols);
+               assert(nbdchg < lp->nchgcols);
                bdind[nbdchg] = col->lpipos;
                lb[nbdchg] = newlb;
                ub[nbdchg] = newub;
@@ -8730,6 +8812,7 @@ SCIP_RETCODE lpFlushChgCols(
    {
       SCIPsetDebugMsg(set, "flushing objective changes: change %d objective values of %d changed columns\n", nobjchg, lp->nchgcols);
       SCIP_CALL( SCIPlpiChgObj(lp->lpi, nobjchg, objind, obj) );
+      lp->nflushlpicalls++;
 
       /* mark the LP unsolved */
       lp->solved = FALSE;
@@ -8744,6 +8827,7 @@ SCIP_RETCODE lpFlushChgCols(
    {
       SCIPsetDebugMsg(set, "flushing bound changes: change %d bounds of %d changed columns\n", nbdchg, lp->nchgcols);
       SCIP_CALL( SCIPlpiChgBounds(lp->lpi, nbdchg, bdind, lb, ub) );
+      lp->nflushlpicalls++;
 
       /* mark the LP unsolved */
       lp->solved = FALSE;
@@ -8791,10 +8875,10 @@ SCIP_RETCODE lpFlushChgRows(
    /* get the solver's infinity value */
    lpiinf = SCIPlpiInfinity(lp->lpi);
 
-   /* get temporary memory for changes */
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, lp->nrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &lhs, lp->nrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &rhs, lp->nrows) );
+   /* get temporary memory for changes; each cached row yields at most one side change */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, lp->nchgrows) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lhs, lp->nchgrows) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &rhs, lp->nchgrows) );
 
    /* collect all cached left and right hand side changes */
    nchg = 0;
@@ -8826,7 +8910,7 @@ SCIP_RETCODE lpFlushChgRows(
             newrhs = (SCIPsetIsInfinity(set, row->rhs) ? lpiinf : row->rhs - row->constant);
             if( row->flushedlhs != newlhs || row->flushedrhs != newrhs ) /*lint !e777*/
             {
-               assert(nchg < lp->nrows);
+               assert(nchg < lp->nchgrows);
                ind[nchg] = row->lpipos;
                lhs[nchg] = newlhs;
                rhs[nchg] = newrhs;
@@ -8845,6 +8929,7 @@ SCIP_RETCODE lpFlushChgRows(
    {
       SCIPsetDebugMsg(set, "flushing side changes: change %d sides of %d rows\n", nchg, lp->nchgrows);
       SCIP_CALL( SCIPlpiChgSides(lp->lpi, nchg, ind, lhs, rhs) );
+      lp->nflushlpicalls++;
 
       /* mark the LP unsolved */
       lp->solved = FALSE;
@@ -9435,6 +9520,7 @@ SCIP_RETCODE SCIPlpCreate(
    (*lp)->divinglpiitlim = INT_MAX;
    (*lp)->resolvelperror = FALSE;
    (*lp)->divenolddomchgs = 0;
+   (*lp)->nflushlpicalls = 0;
    (*lp)->adjustlpval = FALSE;
    (*lp)->lpiobjlim = SCIPlpiInfinity((*lp)->lpi);
    (*lp)->lpifeastol = (*lp)->feastol;
@@ -17316,6 +17402,7 @@ SCIP_RETCODE SCIPlpWriteMip(
 #undef SCIPlpGetLPI
 #undef SCIPlpSetIsRelax
 #undef SCIPlpIsRelax
+#undef SCIPlpGetNFlushLPICalls
 #undef SCIPlpIsSolved
 #undef SCIPlpIsSolBasic
 #undef SCIPlpDiving
@@ -18217,6 +18304,16 @@ SCIP_Bool SCIPlpIsSolved(
    return lp->flushed && lp->solved;
 }
 
+/** gets number of LP interface calls for applying cached changes to the LP solver */
+SCIP_Longint SCIPlpGetNFlushLPICalls(
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   assert(lp != NULL);
+
+   return lp->nflushlpicalls;
+}
+
 /** return whether the current LP solution passed the primal feasibility check */
 SCIP_Bool SCIPlpIsPrimalReliable(
    SCIP_LP*              lp                  /**< current LP data */
@@ -738,6 +738,20 @@ SCIP_Real SCIProwGetObjParallelism(
    SCIP_LP*              lp                  /**< current LP data */
    );
 
+/** computes the euclidean parallelism p = |v*w|/(|v|*|w|) between a row v and each row w of the given array, which
+ *  equals SCIProwGetParallelism() with orthofunc 'e'; as in SCIProwGetScalarProduct() and the row norms, only columns
+ *  that are currently in the LP contribute, for rows in and not in the LP alike; the first row is scattered into a
+ *  dense array once, such that each scalar product only needs a single pass over the nonzeros of the other row
+ */
+SCIP_RETCODE SCIProwGetParallelisms(
+   SCIP_ROW*             row,                /**< LP row */
+   SCIP_ROW**            rows,               /**< LP rows to compute the parallelism with */
+   int                   nrows,              /**< number of rows in the array */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_Real*            parallelisms        /**< array to store the parallelisms of the rows */
+   );
+
 /** includes event handler with given data in row's event filter */
 SCIP_RETCODE SCIProwCatchEvent(
    SCIP_ROW*             row,                /**< row */
@@ -1539,6 +1553,11 @@ SCIP_Bool SCIPlpIsSolved(
    SCIP_LP*              lp                  /**< current LP data */
    );
 
+/** gets number of LP interface calls for applying cached changes to the LP solver */
+SCIP_Longint SCIPlpGetNFlushLPICalls(
+   SCIP_LP*              lp                  /**< current LP data */
+   );
+
 /** return whether the current LP solution passed the primal feasibility check */
 SCIP_Bool SCIPlpIsPrimalReliable(
    SCIP_LP*              lp                  /**< current LP data */
@@ -1659,6 +1678,7 @@ SCIP_Bool SCIPlpIsFeasNegative(
 #define SCIPlpGetLPI(lp)                (lp)->lpi
 #define SCIPlpSetIsRelax(lp,relax)      ((lp)->isrelax = relax)
 #define SCIPlpIsRelax(lp)               (lp)->isrelax
+#define SCIPlpGetNFlushLPICalls(lp)     ((lp)->nflushlpicalls)
 #define SCIPlpIsSolved(lp)              ((lp)->flushed && (lp)->solved)
 #define SCIPlpIsSolBasic(lp)            ((lp)->solisbasic)
 #define SCIPlpDiving(lp)                (lp)->diving
@@ -2020,6 +2020,9 @@ SCIP_RETCODE boundShift(
    SCIP_Real* fpdual;
    SCIP_Real* fpdualcolwise;
    SCIP_Real computedbound;
+   SCIP_ROUNDMODE roundmode;
+   int* colbeg;
+   int nnonz;
    int i;
    int j;
 
@@ -2042,8 +2045,6 @@ SCIP_RETCODE boundShift(
    SCIP_CALL( SCIPsetAllocBufferArray(set, &fpdual, lp->nrows) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &rhslhsrow, lp->nrows) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &constantinter, lp->nrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &fpdualcolwise, lp->nrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &lpcolvals, lp->nrows) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &productcoldualval, lp->ncols) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->ncols) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &ublbcol, lp->ncols) );
@@ -2053,6 +2054,15 @@ SCIP_RETCODE boundShift(
    SCIP_CALL( SCIPlpExactSyncLPs(lpexact, blkmem, set) );
    SCIP_CALL( SCIPlpExactLink(lpexact, blkmem, set, eventqueue) );
 
+   /* allocate memory for the nonzeros of the columns in the LP rows */
+   nnonz = 0;
+   for( j = 0; j < lp->ncols; ++j )
+      nnonz += SCIPcolGetColExact(lp->cols[j])->nlprows;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &colbeg, lp->ncols + 1) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &fpdualcolwise, nnonz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lpcolvals, nnonz) );
+
    /* reset proved bound status */
    lp->hasprovedbound = FALSE;
 
@@ -2105,7 +2115,10 @@ SCIP_RETCODE boundShift(
 
    SCIPdebugMessage("   resulting scalar product=[%g,%g]\n", SCIPintervalGetInf(productsidedualval), SCIPintervalGetSup(productsidedualval));
 
-   /* calculate min{(obj - dual^TMatrix)redcost} */
+   /* calculate min{(obj - dual^TMatrix)redcost}: first, create the -Matrix.j vectors in interval arithmetic and the
+    * corresponding dual vectors of all columns; entries with zero dual value do not contribute to the products
+    */
+   nnonz = 0;
    for( j = 0; j < lp->ncols; ++j )
    {
       col = lp->cols[j];
@@ -2116,7 +2129,7 @@ SCIP_RETCODE boundShift(
 
       assert(colexact != NULL);
 
-      /* create -Matrix.j vector in interval arithmetic and corresponding dual vector and compute infimum of vector -Matrix.j^Tdual */
+      colbeg[j] = nnonz;
       for( i = 0; i < colexact->nlprows; ++i )
       {
          SCIP_INTERVAL val;
@@ -2128,15 +2141,16 @@ SCIP_RETCODE boundShift(
 
          rowexact = colexact->rows[i];
 
+         if( fpdual[rowexact->lppos] == 0.0 )
+            continue;
+
          val = rowexact->valsinterval[colexact->linkpos[i]];
          assert(SCIPrationalIsGEReal(colexact->vals[i], val.inf) && SCIPrationalIsLEReal(colexact->vals[i], val.sup));
 
-         SCIPintervalSetBounds(&lpcolvals[i], -val.sup, -val.inf);
-         fpdualcolwise[i] = fpdual[colexact->rows[i]->lppos];
+         SCIPintervalSetBounds(&lpcolvals[nnonz], -val.sup, -val.inf);
+         fpdualcolwise[nnonz] = fpdual[rowexact->lppos];
+         ++nnonz;
       }
-      productcoldualval[j].inf = 0.0;
-      productcoldualval[j].sup = 0.0;
-      SCIPintervalScalprodScalars(SCIPsetInfinity(set), &productcoldualval[j], colexact->nlprows, lpcolvals, fpdualcolwise);
 
 #ifndef NDEBUG
       for( i = colexact->nlprows; i < colexact->len; ++i )
@@ -2147,6 +2161,26 @@ SCIP_RETCODE boundShift(
       }
 #endif
    }
+   colbeg[lp->ncols] = nnonz;
+
+   /* compute the infima and suprema of all vectors -Matrix.j^Tdual, switching the rounding mode only once for each */
+   roundmode = SCIPintervalGetRoundingMode();
+
+   SCIPintervalSetRoundingModeDownwards();
+   for( j = 0; j < lp->ncols; ++j )
+   {
+      SCIPintervalScalprodScalarsInf(SCIPsetInfinity(set), &productcoldualval[j], colbeg[j + 1] - colbeg[j],
+         &lpcolvals[colbeg[j]], &fpdualcolwise[colbeg[j]]);
+   }
+
+   SCIPintervalSetRoundingModeUpwards();
+   for( j = 0; j < lp->ncols; ++j )
+   {
+      SCIPintervalScalprodScalarsSup(SCIPsetInfinity(set), &productcoldualval[j], colbeg[j + 1] - colbeg[j],
+         &lpcolvals[colbeg[j]], &fpdualcolwise[colbeg[j]]);
+   }
+
+   SCIPintervalSetRoundingMode(roundmode);
 
    /* create objective vector and lb/ub vector in interval arithmetic and compute min{(obj^T - dual^TMatrix)lb/ub} */
    for( j = 0; j < lp->ncols; ++j )
@@ -2287,11 +2321,12 @@ CLEANUP:
       lpexact->boundshiftuseful = FALSE;
    }
    /* free buffer for storing y in interval arithmetic */
+   SCIPsetFreeBufferArray(set, &lpcolvals);
+   SCIPsetFreeBufferArray(set, &fpdualcolwise);
+   SCIPsetFreeBufferArray(set, &colbeg);
    SCIPsetFreeBufferArray(set, &ublbcol);
    SCIPsetFreeBufferArray(set, &obj);
    SCIPsetFreeBufferArray(set, &productcoldualval);
-   SCIPsetFreeBufferArray(set, &lpcolvals);
-   SCIPsetFreeBufferArray(set, &fpdualcolwise);
    SCIPsetFreeBufferArray(set, &constantinter);
    SCIPsetFreeBufferArray(set, &rhslhsrow);
    SCIPsetFreeBufferArray(set, &fpdual);
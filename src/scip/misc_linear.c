@@ -41,6 +41,27 @@
 #include "scip/scipdefplugins.h"
 
 
+/** returns whether an arbitrary SCIP constraint is of a type that can be represented as a single linear constraint,
+ *  i.e., whether SCIPconsGetLhs() and SCIPconsGetRhs() can return its sides
+ *
+ *  @note This check does not print a warning for other constraints, in contrast to the getters of the sides.
+ */
+SCIP_Bool SCIPconsIsLinearRepresentable(
+   SCIP_CONS*            cons                /**< constraint to check */
+   )
+{
+   const char* conshdlrname;
+
+   assert(cons != NULL);
+   assert(SCIPconsGetHdlr(cons) != NULL);
+
+   conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(cons));
+
+   return strcmp(conshdlrname, "linear") == 0 || strcmp(conshdlrname, "setppc") == 0
+      || strcmp(conshdlrname, "logicor") == 0 || strcmp(conshdlrname, "knapsack") == 0
+      || strcmp(conshdlrname, "varbound") == 0;
+}
+
 /** returns the right-hand side of an arbitrary SCIP constraint that can be represented as a single linear constraint
  *
  *  @note The success pointer indicates if the individual contraint handler was able to return the involved values
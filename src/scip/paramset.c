@@ -3526,6 +3526,7 @@ SCIP_RETCODE paramsetSetSeparatingDefault(
    SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/maxaddrounds") );
    SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/maxcutsroot") );
    SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/poolfreq") );
+   SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/negpriofreq") );
    SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/aggregation/maxfailsroot") );
    SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/mcf/maxtestdelta") );
    SCIP_CALL( SCIPparamsetSetToDefault(paramset, set, messagehdlr, "separating/mcf/trynegscaling") );
@@ -3729,6 +3730,9 @@ SCIP_RETCODE paramsetSetSeparatingFast(
    /* explicitly decrease maxbounddist */
    SCIP_CALL( paramSetReal(paramset, set, messagehdlr, "separating/maxbounddist", 0.0, quiet) );
 
+   /* only call separators with negative priority if the other separators found no cuts */
+   SCIP_CALL( paramSetInt(paramset, set, messagehdlr, "separating/negpriofreq", 0, quiet) );
+
    /* explicitly turn off expensive separators, if included */
 #ifndef NDEBUG
    if( SCIPsetFindConshdlr(set, "and") != NULL )
@@ -0,0 +1,1389 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   presol_cache.c
+ * @ingroup DEFPLUGINS_PRESOL
+ * @brief  cache presolver: stores presolved problems on disk and reloads them when the same instance is solved again
+ *
+ * See presol_cache.h for a description of the cached data.
+ *
+ * The presolver has the highest priority of all presolvers and the timings fast and final. In its first call, which
+ * happens in the first fast presolving round, it tries to reload the cached problem. In the first call with timing
+ * final, i.e., when presolving found too few reductions to continue, it writes the presolved problem. At this point,
+ * symmetry handling methods have not been added yet, such that the cached problem only contains reductions that are
+ * valid for every later run on the same instance.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/binaryio.h"
+#include "scip/cons_linear.h"
+#include "scip/presol_cache.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_linear.h"
+#include "scip/pub_paramset.h"
+#include "scip/pub_presol.h"
+#include "scip/pub_var.h"
+#include "scip/scip_benders.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_exact.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_presol.h"
+#include "scip/scip_pricer.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solve.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_timing.h"
+#include "scip/scip_var.h"
+#include "symmetry/type_symmetry.h"
+#include <stdio.h>
+#include <string.h>
+
+
+#define PRESOL_NAME            "cache"
+#define PRESOL_DESC            "stores presolved problems on disk and reloads them for the same instance"
+#define PRESOL_PRIORITY       +99999999 /**< priority of the presolver (>= 0: before, < 0: after constraint handlers) */
+#define PRESOL_MAXROUNDS             -1 /**< maximal number of presolving rounds the presolver participates in (-1: no limit) */
+#define PRESOL_TIMING           (SCIP_PRESOLTIMING_FAST | SCIP_PRESOLTIMING_FINAL) /* timing of the presolver (fast, medium, or exhaustive) */
+
+#define DEFAULT_DIRECTORY            "" /**< directory to store cached presolved problems in, or "" to disable the cache */
+
+#define CACHE_MAGIC            "SCIPPCH"    /**< magic string at the beginning of each cache file */
+#define CACHE_VERSION          2            /**< version of the file format */
+#define CACHE_EXTENSION        "pcache"     /**< extension of cache files */
+
+#define FNV_OFFSET             UINT64_C(14695981039346656037) /**< offset basis of the 64-bit FNV-1a hash */
+#define FNV_PRIME              UINT64_C(1099511628211)        /**< prime of the 64-bit FNV-1a hash */
+
+/* flags of cached constraints */
+#define CONSFLAG_INITIAL       0x001u
+#define CONSFLAG_SEPARATE      0x002u
+#define CONSFLAG_ENFORCE       0x004u
+#define CONSFLAG_CHECK         0x008u
+#define CONSFLAG_PROPAGATE     0x010u
+#define CONSFLAG_MODIFIABLE    0x020u
+#define CONSFLAG_DYNAMIC       0x040u
+#define CONSFLAG_REMOVABLE     0x080u
+#define CONSFLAG_STICKINGATNODE 0x100u
+
+/** prefixes of parameters that do not influence presolving and are therefore not part of the hash value */
+static const char* ignoredparams[] =
+{
+   "branching/", "concurrent/", "display/", "heuristics/", "limits/", "nodeselection/", "parallel/",
+   "presolving/" PRESOL_NAME "/", "separating/", "timing/", "visual/", "write/"
+};
+
+/** presolver data */
+struct SCIP_PresolData
+{
+   char*                 directory;          /**< directory to store cached presolved problems in, or "" to disable the cache */
+   uint64_t              hash;               /**< hash value of the original problem and the relevant parameters */
+   SCIP_Bool             enabled;            /**< is the cache used in the current presolving? */
+   SCIP_Bool             triedload;          /**< did we already try to load the cached problem? */
+   SCIP_Bool             loaded;             /**< was the presolved problem loaded from the cache? */
+   SCIP_Bool             written;            /**< was the presolved problem already written to the cache? */
+};
+
+/** header of a cache file */
+struct CacheHeader
+{
+   SCIP_BINARYHEADER     binary;             /**< magic string CACHE_MAGIC, format version, and byte order mark */
+   uint64_t              hash;               /**< hash value of the original problem and the relevant parameters */
+   int                   norigvars;          /**< number of original variables */
+   int                   nvars;              /**< number of active variables */
+   int                   nconss;             /**< number of constraints */
+   int                   nnonzeros;          /**< number of nonzeros of the constraint matrix */
+   int                   nrepnonzeros;       /**< number of nonzeros of the representations of the original variables */
+   int                   hassol;             /**< are values of a solution stored? */
+   SCIP_Longint          namessize;          /**< size of the name block in bytes */
+};
+typedef struct CacheHeader CACHEHEADER;
+
+/** presolved problem as stored in a cache file */
+struct PresolCache
+{
+   int*                  origidxs;           /**< index of the original variable of each active variable, or -1 */
+   SCIP_Real*            lbs;                /**< global lower bounds of the active variables */
+   SCIP_Real*            ubs;                /**< global upper bounds of the active variables */
+   char*                 vartypes;           /**< types of the active variables */
+   char*                 impltypes;          /**< implied integral types of the active variables */
+   int*                  repbeg;             /**< start of the representation of each original variable (norigvars + 1) */
+   int*                  repinds;            /**< active variable indices of the representations */
+   SCIP_Real*            repvals;            /**< scalars of the representations */
+   SCIP_Real*            repconsts;          /**< constants of the representations */
+   unsigned int*         consflags;          /**< flags of the constraints */
+   SCIP_Real*            lhss;               /**< left hand sides of the constraints */
+   SCIP_Real*            rhss;               /**< right hand sides of the constraints */
+   int*                  beg;                /**< start of each constraint in the matrix (nconss + 1) */
+   int*                  inds;               /**< active variable indices of the matrix */
+   SCIP_Real*            vals;               /**< coefficients of the matrix */
+   SCIP_Real*            solvals;            /**< solution values of the original variables, or NULL */
+   char*                 names;              /**< names of the active variables without original variable and of the constraints */
+   int                   norigvars;          /**< number of original variables */
+   int                   nvars;              /**< number of active variables */
+   int                   nconss;             /**< number of constraints */
+   int                   nnonzeros;          /**< number of nonzeros of the constraint matrix */
+   int                   nrepnonzeros;       /**< number of nonzeros of the representations */
+   int                   repnonzerossize;    /**< size of the representation arrays */
+   int                   nonzerossize;       /**< size of the matrix arrays */
+   SCIP_Longint          namessize;          /**< size of the name block in bytes */
+};
+typedef struct PresolCache PRESOLCACHE;
+
+
+/*
+ * Local methods
+ */
+
+/** adds bytes to a 64-bit FNV-1a hash value */
+static
+void hashBytes(
+   uint64_t*             hash,               /**< pointer to hash value to update */
+   const void*           data,               /**< data to add */
+   size_t                size                /**< size of the data in bytes */
+   )
+{
+   const unsigned char* bytes = (const unsigned char*)data;
+   size_t i;
+
+   for( i = 0; i < size; ++i )
+   {
+      *hash ^= bytes[i];
+      *hash *= FNV_PRIME;
+   }
+}
+
+/** adds a null-terminated string to a hash value */
+static
+void hashString(
+   uint64_t*             hash,               /**< pointer to hash value to update */
+   const char*           str                 /**< string to add */
+   )
+{
+   hashBytes(hash, str, strlen(str) + 1);
+}
+
+/** adds an integer to a hash value */
+static
+void hashInt(
+   uint64_t*             hash,               /**< pointer to hash value to update */
+   int                   val                 /**< value to add */
+   )
+{
+   hashBytes(hash, &val, sizeof(val));
+}
+
+/** adds a real value to a hash value */
+static
+void hashReal(
+   uint64_t*             hash,               /**< pointer to hash value to update */
+   SCIP_Real             val                 /**< value to add */
+   )
+{
+   hashBytes(hash, &val, sizeof(val));
+}
+
+/** adds all non-default parameters that may influence presolving to a hash value */
+static
+void hashParams(
+   SCIP*                 scip,               /**< SCIP data structure */
+   uint64_t*             hash                /**< pointer to hash value to update */
+   )
+{
+   SCIP_PARAM** params;
+   int nparams;
+   int i;
+
+   params = SCIPgetParams(scip);
+   nparams = SCIPgetNParams(scip);
+
+   for( i = 0; i < nparams; ++i )
+   {
+      const char* name;
+      size_t p;
+
+      if( SCIPparamIsDefault(params[i]) )
+         continue;
+
+      name = SCIPparamGetName(params[i]);
+
+      for( p = 0; p < sizeof(ignoredparams) / sizeof(ignoredparams[0]); ++p )
+      {
+         if( strncmp(name, ignoredparams[p], strlen(ignoredparams[p])) == 0 )
+            break;
+      }
+      if( p < sizeof(ignoredparams) / sizeof(ignoredparams[0]) )
+         continue;
+
+      hashString(hash, name);
+
+      switch( SCIPparamGetType(params[i]) )
+      {
+      case SCIP_PARAMTYPE_BOOL:
+         hashInt(hash, (int)SCIPparamGetBool(params[i]));
+         break;
+      case SCIP_PARAMTYPE_INT:
+         hashInt(hash, SCIPparamGetInt(params[i]));
+         break;
+      case SCIP_PARAMTYPE_LONGINT:
+      {
+         SCIP_Longint val = SCIPparamGetLongint(params[i]);
+
+         hashBytes(hash, &val, sizeof(val));
+         break;
+      }
+      case SCIP_PARAMTYPE_REAL:
+         hashReal(hash, SCIPparamGetReal(params[i]));
+         break;
+      case SCIP_PARAMTYPE_CHAR:
+         hashInt(hash, (int)SCIPparamGetChar(params[i]));
+         break;
+      case SCIP_PARAMTYPE_STRING:
+         hashString(hash, SCIPparamGetString(params[i]));
+         break;
+      default:
+         SCIPABORT();
+      }
+   }
+}
+
+/** computes the hash value of the original problem and the relevant parameters; if one of the original constraints
+ *  cannot be represented as a linear constraint, no hash value is computed
+ */
+static
+SCIP_RETCODE computeHash(
+   SCIP*                 scip,               /**< SCIP data structure */
+   uint64_t*             hash,               /**< pointer to store the hash value */
+   SCIP_Bool*            success             /**< pointer to store whether the hash value was computed */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_CONS** conss;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   int consvarssize;
+   int nvars;
+   int nconss;
+   int c;
+   int v;
+
+   assert(hash != NULL);
+   assert(success != NULL);
+
+   *hash = FNV_OFFSET;
+   *success = TRUE;
+
+   hashInt(hash, SCIP_VERSION);
+   hashInt(hash, CACHE_VERSION);
+   hashString(hash, SCIPgetProbName(scip));
+   hashInt(hash, (int)SCIPgetObjsense(scip));
+   hashReal(hash, SCIPgetOrigObjoffset(scip));
+   hashReal(hash, SCIPgetOrigObjscale(scip));
+   hashReal(hash, SCIPgetObjlimit(scip));
+
+   vars = SCIPgetOrigVars(scip);
+   nvars = SCIPgetNOrigVars(scip);
+   hashInt(hash, nvars);
+
+   for( v = 0; v < nvars; ++v )
+   {
+      hashString(hash, SCIPvarGetName(vars[v]));
+      hashInt(hash, (int)SCIPvarGetType(vars[v]));
+      hashInt(hash, (int)SCIPvarGetImplType(vars[v]));
+      hashReal(hash, SCIPvarGetLbOriginal(vars[v]));
+      hashReal(hash, SCIPvarGetUbOriginal(vars[v]));
+      hashReal(hash, SCIPvarGetObj(vars[v]));
+   }
+
+   conss = SCIPgetOrigConss(scip);
+   nconss = SCIPgetNOrigConss(scip);
+   hashInt(hash, nconss);
+
+   consvarssize = 0;
+   consvars = NULL;
+   consvals = NULL;
+
+   for( c = 0; c < nconss && *success; ++c )
+   {
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+      int nconsvars;
+
+      /* check the type first, since the getters of the sides and coefficients print a warning for other constraints */
+      if( !SCIPconsIsLinearRepresentable(conss[c]) )
+      {
+         *success = FALSE;
+         break;
+      }
+
+      SCIP_CALL( SCIPgetConsNVars(scip, conss[c], &nconsvars, success) );
+      if( !*success )
+         break;
+
+      if( nconsvars > consvarssize )
+      {
+         int newsize;
+
+         newsize = SCIPcalcMemGrowSize(scip, nconsvars);
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvars, newsize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvals, newsize) );
+         consvarssize = newsize;
+      }
+
+      if( nconsvars > 0 )
+      {
+         SCIP_CALL( SCIPgetConsVars(scip, conss[c], consvars, consvarssize, success) );
+         if( !*success )
+            break;
+
+         SCIP_CALL( SCIPgetConsVals(scip, conss[c], consvals, consvarssize, success) );
+         if( !*success )
+            break;
+      }
+
+      lhs = SCIPconsGetLhs(scip, conss[c], success);
+      if( !*success )
+         break;
+
+      rhs = SCIPconsGetRhs(scip, conss[c], success);
+      if( !*success )
+         break;
+
+      hashString(hash, SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])));
+      hashString(hash, SCIPconsGetName(conss[c]));
+      hashInt(hash, (int)SCIPconsIsChecked(conss[c]));
+      hashInt(hash, (int)SCIPconsIsEnforced(conss[c]));
+      hashInt(hash, (int)SCIPconsIsModifiable(conss[c]));
+      hashReal(hash, lhs);
+      hashReal(hash, rhs);
+      hashInt(hash, nconsvars);
+
+      for( v = 0; v < nconsvars; ++v )
+      {
+         hashString(hash, SCIPvarGetName(consvars[v]));
+         hashReal(hash, consvals[v]);
+      }
+   }
+
+   SCIPfreeBufferArrayNull(scip, &consvals);
+   SCIPfreeBufferArrayNull(scip, &consvars);
+
+   if( *success )
+      hashParams(scip, hash);
+
+   return SCIP_OKAY;
+}
+
+/** creates the name of the cache file */
+static
+void getCacheFilename(
+   SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   char*                 filename            /**< buffer of size SCIP_MAXSTRLEN to store the file name */
+   )
+{
+   (void)SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s/%08x%08x." CACHE_EXTENSION, presoldata->directory,
+      (unsigned int)(presoldata->hash >> 32), (unsigned int)(presoldata->hash & 0xffffffffu));
+}
+
+/** frees the arrays of a cached problem */
+static
+void cacheFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PRESOLCACHE*          cache               /**< cached problem */
+   )
+{
+   assert(cache != NULL);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->names, cache->namessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->solvals, cache->norigvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->vals, cache->nonzerossize);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->inds, cache->nonzerossize);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->beg, cache->nconss + 1);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->rhss, cache->nconss);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->lhss, cache->nconss);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->consflags, cache->nconss);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->repconsts, cache->norigvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->repvals, cache->repnonzerossize);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->repinds, cache->repnonzerossize);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->repbeg, cache->norigvars + 1);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->impltypes, cache->nvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->vartypes, cache->nvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->ubs, cache->nvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->lbs, cache->nvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &cache->origidxs, cache->nvars);
+}
+
+/** allocates the arrays of a cached problem whose sizes are given in the cache */
+static
+SCIP_RETCODE cacheAlloc(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PRESOLCACHE*          cache,              /**< cached problem */
+   SCIP_Bool             hassol              /**< should solution values be stored? */
+   )
+{
+   assert(cache != NULL);
+
+   cache->repnonzerossize = MAX(cache->nrepnonzeros, 1);
+   cache->nonzerossize = MAX(cache->nnonzeros, 1);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->origidxs, cache->nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->lbs, cache->nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->ubs, cache->nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->vartypes, cache->nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->impltypes, cache->nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->repbeg, cache->norigvars + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->repinds, cache->repnonzerossize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->repvals, cache->repnonzerossize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->repconsts, cache->norigvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->consflags, cache->nconss) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->lhss, cache->nconss) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->rhss, cache->nconss) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->beg, cache->nconss + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->inds, cache->nonzerossize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->vals, cache->nonzerossize) );
+
+   if( hassol )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->solvals, cache->norigvars) );
+   }
+
+   if( cache->namessize > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->names, cache->namessize) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** ensures that the arrays of the representations or of the matrix can store the given number of nonzeros */
+static
+SCIP_RETCODE ensureNonzerosSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int**                 inds,               /**< pointer to the index array */
+   SCIP_Real**           vals,               /**< pointer to the value array */
+   int*                  size,               /**< pointer to the size of the arrays */
+   int                   num                 /**< minimal number of entries to store */
+   )
+{
+   if( num > *size )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, num);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, inds, *size, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, vals, *size, newsize) );
+      *size = newsize;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** collects the presolved problem; if a constraint cannot be represented as a linear constraint, success is set to
+ *  FALSE
+ */
+static
+SCIP_RETCODE cacheCollect(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PRESOLCACHE*          cache,              /**< cached problem to fill */
+   SCIP_Bool*            success             /**< pointer to store whether the problem could be collected */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR** origvars;
+   SCIP_VAR** vars;
+   SCIP_CONS** conss;
+   SCIP_VAR** activevars;
+   SCIP_Real* activevals;
+   SCIP_SOL* bestsol;
+   SCIP_Longint namepos;
+   int activevarssize;
+   int requiredsize;
+   int nactivevars;
+   int c;
+   int i;
+   int v;
+
+   assert(cache != NULL);
+   assert(success != NULL);
+
+   *success = TRUE;
+
+   origvars = SCIPgetOrigVars(scip);
+   vars = SCIPgetVars(scip);
+   conss = SCIPgetConss(scip);
+   bestsol = SCIPgetBestSol(scip);
+
+   cache->norigvars = SCIPgetNOrigVars(scip);
+   cache->nvars = SCIPgetNVars(scip);
+   cache->nconss = SCIPgetNConss(scip);
+   cache->nnonzeros = 0;
+   cache->nrepnonzeros = 0;
+   cache->namessize = 0;
+
+   /* the sizes of the nonzero arrays are only estimates, and the names are allocated below */
+   SCIP_CALL( cacheAlloc(scip, cache, bestsol != NULL) );
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), MAX(cache->nvars, 1)) );
+
+   for( v = 0; v < cache->nvars; ++v )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*)vars[v], v) );
+
+      cache->origidxs[v] = -1;
+      cache->lbs[v] = SCIPvarGetLbGlobal(vars[v]);
+      cache->ubs[v] = SCIPvarGetUbGlobal(vars[v]);
+      cache->vartypes[v] = (char)SCIPvarGetType(vars[v]);
+      cache->impltypes[v] = (char)SCIPvarGetImplType(vars[v]);
+   }
+
+   activevarssize = MAX(cache->nvars, 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &activevars, activevarssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &activevals, activevarssize) );
+
+   /* represent each original variable by the active variables */
+   for( i = 0; i < cache->norigvars; ++i )
+   {
+      SCIP_VAR* transvar;
+
+      transvar = SCIPvarGetTransVar(origvars[i]);
+      assert(transvar != NULL);
+
+      if( SCIPhashmapExists(varmap, (void*)transvar) )
+         cache->origidxs[SCIPhashmapGetImageInt(varmap, (void*)transvar)] = i;
+
+      activevars[0] = transvar;
+      activevals[0] = 1.0;
+      nactivevars = 1;
+      cache->repconsts[i] = 0.0;
+
+      SCIP_CALL( SCIPgetProbvarLinearSum(scip, activevars, activevals, &nactivevars, activevarssize,
+            &cache->repconsts[i], &requiredsize) );
+      assert(requiredsize <= activevarssize);
+
+      SCIP_CALL( ensureNonzerosSize(scip, &cache->repinds, &cache->repvals, &cache->repnonzerossize,
+            cache->nrepnonzeros + nactivevars) );
+
+      cache->repbeg[i] = cache->nrepnonzeros;
+
+      for( v = 0; v < nactivevars; ++v )
+      {
+         assert(SCIPhashmapExists(varmap, (void*)activevars[v]));
+
+         cache->repinds[cache->nrepnonzeros] = SCIPhashmapGetImageInt(varmap, (void*)activevars[v]);
+         cache->repvals[cache->nrepnonzeros] = activevals[v];
+         ++cache->nrepnonzeros;
+      }
+
+      if( cache->solvals != NULL )
+         cache->solvals[i] = SCIPgetSolVal(scip, bestsol, origvars[i]);
+   }
+   cache->repbeg[cache->norigvars] = cache->nrepnonzeros;
+
+   /* represent each constraint as a linear constraint over the active variables */
+   for( c = 0; c < cache->nconss && *success; ++c )
+   {
+      SCIP_Real constant;
+
+      /* check the type first, since the getters of the sides and coefficients print a warning for other constraints */
+      if( !SCIPconsIsLinearRepresentable(conss[c]) )
+      {
+         *success = FALSE;
+         break;
+      }
+
+      SCIP_CALL( SCIPgetConsNVars(scip, conss[c], &nactivevars, success) );
+      if( !*success )
+         break;
+
+      if( nactivevars > activevarssize )
+      {
+         activevarssize = SCIPcalcMemGrowSize(scip, nactivevars);
+         SCIP_CALL( SCIPreallocBufferArray(scip, &activevars, activevarssize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &activevals, activevarssize) );
+      }
+
+      if( nactivevars > 0 )
+      {
+         SCIP_CALL( SCIPgetConsVars(scip, conss[c], activevars, activevarssize, success) );
+         if( !*success )
+            break;
+
+         SCIP_CALL( SCIPgetConsVals(scip, conss[c], activevals, activevarssize, success) );
+         if( !*success )
+            break;
+      }
+
+      cache->lhss[c] = SCIPconsGetLhs(scip, conss[c], success);
+      if( !*success )
+         break;
+
+      cache->rhss[c] = SCIPconsGetRhs(scip, conss[c], success);
+      if( !*success )
+         break;
+
+      constant = 0.0;
+      SCIP_CALL( SCIPgetProbvarLinearSum(scip, activevars, activevals, &nactivevars, activevarssize, &constant,
+            &requiredsize) );
+
+      /* the constraint variables have to be collected again if the arrays are too small */
+      if( requiredsize > activevarssize )
+      {
+         activevarssize = requiredsize;
+         SCIP_CALL( SCIPreallocBufferArray(scip, &activevars, activevarssize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &activevals, activevarssize) );
+
+         SCIP_CALL( SCIPgetConsNVars(scip, conss[c], &nactivevars, success) );
+         SCIP_CALL( SCIPgetConsVars(scip, conss[c], activevars, activevarssize, success) );
+         SCIP_CALL( SCIPgetConsVals(scip, conss[c], activevals, activevarssize, success) );
+         assert(*success);
+
+         constant = 0.0;
+         SCIP_CALL( SCIPgetProbvarLinearSum(scip, activevars, activevals, &nactivevars, activevarssize, &constant,
+               &requiredsize) );
+      }
+      assert(requiredsize <= activevarssize);
+
+      if( !SCIPisInfinity(scip, -cache->lhss[c]) )
+         cache->lhss[c] -= constant;
+      if( !SCIPisInfinity(scip, cache->rhss[c]) )
+         cache->rhss[c] -= constant;
+
+      SCIP_CALL( ensureNonzerosSize(scip, &cache->inds, &cache->vals, &cache->nonzerossize,
+            cache->nnonzeros + nactivevars) );
+
+      cache->beg[c] = cache->nnonzeros;
+
+      for( v = 0; v < nactivevars; ++v )
+      {
+         if( activevals[v] == 0.0 ) /*lint !e777*/
+            continue;
+
+         assert(SCIPhashmapExists(varmap, (void*)activevars[v]));
+
+         cache->inds[cache->nnonzeros] = SCIPhashmapGetImageInt(varmap, (void*)activevars[v]);
+         cache->vals[cache->nnonzeros] = activevals[v];
+         ++cache->nnonzeros;
+      }
+
+      cache->consflags[c] = (SCIPconsIsInitial(conss[c]) ? CONSFLAG_INITIAL : 0u)
+         | (SCIPconsIsSeparated(conss[c]) ? CONSFLAG_SEPARATE : 0u)
+         | (SCIPconsIsEnforced(conss[c]) ? CONSFLAG_ENFORCE : 0u)
+         | (SCIPconsIsChecked(conss[c]) ? CONSFLAG_CHECK : 0u)
+         | (SCIPconsIsPropagated(conss[c]) ? CONSFLAG_PROPAGATE : 0u)
+         | (SCIPconsIsModifiable(conss[c]) ? CONSFLAG_MODIFIABLE : 0u)
+         | (SCIPconsIsDynamic(conss[c]) ? CONSFLAG_DYNAMIC : 0u)
+         | (SCIPconsIsRemovable(conss[c]) ? CONSFLAG_REMOVABLE : 0u)
+         | (SCIPconsIsStickingAtNode(conss[c]) ? CONSFLAG_STICKINGATNODE : 0u);
+
+      cache->namessize += (SCIP_Longint)strlen(SCIPconsGetName(conss[c])) + 1;
+   }
+
+   SCIPfreeBufferArray(scip, &activevals);
+   SCIPfreeBufferArray(scip, &activevars);
+   SCIPhashmapFree(&varmap);
+
+   if( !*success )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+         "presolved problem is not cached, because constraint <%s> of type <%s> is not linear\n",
+         SCIPconsGetName(conss[c]), SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])));
+      return SCIP_OKAY;
+   }
+   cache->beg[cache->nconss] = cache->nnonzeros;
+
+   /* store names of the variables without original counterpart and of the constraints */
+   for( v = 0; v < cache->nvars; ++v )
+   {
+      if( cache->origidxs[v] == -1 )
+         cache->namessize += (SCIP_Longint)strlen(SCIPvarGetName(vars[v])) + 1;
+   }
+
+   if( cache->namessize > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cache->names, cache->namessize) );
+   }
+
+   namepos = 0;
+   for( v = 0; v < cache->nvars; ++v )
+   {
+      if( cache->origidxs[v] == -1 )
+      {
+         size_t len = strlen(SCIPvarGetName(vars[v])) + 1;
+
+         BMScopyMemoryArray(&cache->names[namepos], SCIPvarGetName(vars[v]), len);
+         namepos += (SCIP_Longint)len;
+      }
+   }
+   for( c = 0; c < cache->nconss; ++c )
+   {
+      size_t len = strlen(SCIPconsGetName(conss[c])) + 1;
+
+      BMScopyMemoryArray(&cache->names[namepos], SCIPconsGetName(conss[c]), len);
+      namepos += (SCIP_Longint)len;
+   }
+   assert(namepos == cache->namessize);
+
+   return SCIP_OKAY;
+}
+
+/** writes a cached problem to a file; the file is first written under a temporary name and then renamed, such that
+ *  concurrent runs never read incomplete files
+ */
+static
+SCIP_RETCODE cacheWrite(
+   SCIP*                 scip,               /**< SCIP data structure */
+   uint64_t              hash,               /**< hash value of the cached problem */
+   PRESOLCACHE*          cache,              /**< cached problem */
+   const char*           filename            /**< name of the cache file */
+   )
+{
+   CACHEHEADER header;
+   char tmpfilename[SCIP_MAXSTRLEN];
+   FILE* file;
+   SCIP_Bool success;
+
+   assert(cache != NULL);
+   assert(filename != NULL);
+
+   (void)SCIPsnprintf(tmpfilename, SCIP_MAXSTRLEN, "%s.tmp", filename);
+
+   file = fopen(tmpfilename, "wb");
+   if( file == NULL )
+   {
+      SCIPwarningMessage(scip, "cannot create cache file <%s>\n", tmpfilename);
+      return SCIP_FILECREATEERROR;
+   }
+
+   BMSclearMemory(&header);
+   SCIPbinaryInitHeader(&header.binary, CACHE_MAGIC, CACHE_VERSION);
+   header.hash = hash;
+   header.norigvars = cache->norigvars;
+   header.nvars = cache->nvars;
+   header.nconss = cache->nconss;
+   header.nnonzeros = cache->nnonzeros;
+   header.nrepnonzeros = cache->nrepnonzeros;
+   header.hassol = cache->solvals != NULL ? 1 : 0;
+   header.namessize = cache->namessize;
+
+   success = SCIPbinaryWriteArray(file, &header, sizeof(header), 1)
+      && SCIPbinaryWriteArray(file, cache->origidxs, sizeof(int), (size_t)cache->nvars)
+      && SCIPbinaryWriteArray(file, cache->lbs, sizeof(SCIP_Real), (size_t)cache->nvars)
+      && SCIPbinaryWriteArray(file, cache->ubs, sizeof(SCIP_Real), (size_t)cache->nvars)
+      && SCIPbinaryWriteArray(file, cache->vartypes, sizeof(char), (size_t)cache->nvars)
+      && SCIPbinaryWriteArray(file, cache->impltypes, sizeof(char), (size_t)cache->nvars)
+      && SCIPbinaryWriteArray(file, cache->repbeg, sizeof(int), (size_t)cache->norigvars + 1)
+      && SCIPbinaryWriteArray(file, cache->repinds, sizeof(int), (size_t)cache->nrepnonzeros)
+      && SCIPbinaryWriteArray(file, cache->repvals, sizeof(SCIP_Real), (size_t)cache->nrepnonzeros)
+      && SCIPbinaryWriteArray(file, cache->repconsts, sizeof(SCIP_Real), (size_t)cache->norigvars)
+      && SCIPbinaryWriteArray(file, cache->consflags, sizeof(unsigned int), (size_t)cache->nconss)
+      && SCIPbinaryWriteArray(file, cache->lhss, sizeof(SCIP_Real), (size_t)cache->nconss)
+      && SCIPbinaryWriteArray(file, cache->rhss, sizeof(SCIP_Real), (size_t)cache->nconss)
+      && SCIPbinaryWriteArray(file, cache->beg, sizeof(int), (size_t)cache->nconss + 1)
+      && SCIPbinaryWriteArray(file, cache->inds, sizeof(int), (size_t)cache->nnonzeros)
+      && SCIPbinaryWriteArray(file, cache->vals, sizeof(SCIP_Real), (size_t)cache->nnonzeros)
+      && (cache->solvals == NULL
+         || SCIPbinaryWriteArray(file, cache->solvals, sizeof(SCIP_Real), (size_t)cache->norigvars))
+      && SCIPbinaryWriteArray(file, cache->names, sizeof(char), (size_t)cache->namessize);
+
+   if( fclose(file) != 0 )
+      success = FALSE;
+
+   if( success && rename(tmpfilename, filename) != 0 )
+      success = FALSE;
+
+   if( !success )
+   {
+      SCIPwarningMessage(scip, "error while writing cache file <%s>\n", filename);
+      (void)remove(tmpfilename);
+      return SCIP_WRITEERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** checks the indices of a sparse matrix in a cached problem */
+static
+SCIP_Bool checkSparse(
+   int*                  beg,                /**< start of each row (nrows + 1) */
+   int*                  inds,               /**< column indices */
+   int                   nrows,              /**< number of rows */
+   int                   nnonzeros,          /**< number of nonzeros */
+   int                   ncols               /**< number of columns */
+   )
+{
+   int i;
+
+   if( beg[0] != 0 || beg[nrows] != nnonzeros )
+      return FALSE;
+
+   for( i = 0; i < nrows; ++i )
+   {
+      if( beg[i] > beg[i + 1] )
+         return FALSE;
+   }
+
+   for( i = 0; i < nnonzeros; ++i )
+   {
+      if( inds[i] < 0 || inds[i] >= ncols )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** reads a cached problem from a file; if the file does not exist or does not match the hash value, success is set
+ *  to FALSE
+ */
+static
+SCIP_RETCODE cacheRead(
+   SCIP*                 scip,               /**< SCIP data structure */
+   uint64_t              hash,               /**< expected hash value */
+   PRESOLCACHE*          cache,              /**< cached problem to fill */
+   const char*           filename,           /**< name of the cache file */
+   SCIP_Bool*            success             /**< pointer to store whether the cached problem was read */
+   )
+{
+   CACHEHEADER header;
+   SCIP_FILE* fp;
+   int nnames;
+   int v;
+
+   assert(cache != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   fp = SCIPfopen(filename, "rb");
+   if( fp == NULL )
+      return SCIP_OKAY;
+
+   if( !SCIPbinaryReadArray(fp, &header, sizeof(header), 1)
+      || SCIPbinaryCheckHeader(&header.binary, CACHE_MAGIC, CACHE_VERSION) != SCIP_BINARYSTATUS_OK
+      || header.hash != hash || header.norigvars != SCIPgetNOrigVars(scip) || header.nvars < 0 || header.nconss < 0
+      || header.nnonzeros < 0 || header.nrepnonzeros < 0 || header.namessize < 0 )
+   {
+      SCIPwarningMessage(scip, "ignoring invalid cache file <%s>\n", filename);
+      SCIPfclose(fp);
+      return SCIP_OKAY;
+   }
+
+   cache->norigvars = header.norigvars;
+   cache->nvars = header.nvars;
+   cache->nconss = header.nconss;
+   cache->nnonzeros = header.nnonzeros;
+   cache->nrepnonzeros = header.nrepnonzeros;
+   cache->namessize = header.namessize;
+
+   SCIP_CALL( cacheAlloc(scip, cache, header.hassol != 0) );
+
+   *success = SCIPbinaryReadArray(fp, cache->origidxs, sizeof(int), (size_t)cache->nvars)
+      && SCIPbinaryReadArray(fp, cache->lbs, sizeof(SCIP_Real), (size_t)cache->nvars)
+      && SCIPbinaryReadArray(fp, cache->ubs, sizeof(SCIP_Real), (size_t)cache->nvars)
+      && SCIPbinaryReadArray(fp, cache->vartypes, sizeof(char), (size_t)cache->nvars)
+      && SCIPbinaryReadArray(fp, cache->impltypes, sizeof(char), (size_t)cache->nvars)
+      && SCIPbinaryReadArray(fp, cache->repbeg, sizeof(int), (size_t)cache->norigvars + 1)
+      && SCIPbinaryReadArray(fp, cache->repinds, sizeof(int), (size_t)cache->nrepnonzeros)
+      && SCIPbinaryReadArray(fp, cache->repvals, sizeof(SCIP_Real), (size_t)cache->nrepnonzeros)
+      && SCIPbinaryReadArray(fp, cache->repconsts, sizeof(SCIP_Real), (size_t)cache->norigvars)
+      && SCIPbinaryReadArray(fp, cache->consflags, sizeof(unsigned int), (size_t)cache->nconss)
+      && SCIPbinaryReadArray(fp, cache->lhss, sizeof(SCIP_Real), (size_t)cache->nconss)
+      && SCIPbinaryReadArray(fp, cache->rhss, sizeof(SCIP_Real), (size_t)cache->nconss)
+      && SCIPbinaryReadArray(fp, cache->beg, sizeof(int), (size_t)cache->nconss + 1)
+      && SCIPbinaryReadArray(fp, cache->inds, sizeof(int), (size_t)cache->nnonzeros)
+      && SCIPbinaryReadArray(fp, cache->vals, sizeof(SCIP_Real), (size_t)cache->nnonzeros)
+      && (cache->solvals == NULL
+         || SCIPbinaryReadArray(fp, cache->solvals, sizeof(SCIP_Real), (size_t)cache->norigvars))
+      && SCIPbinaryReadArray(fp, cache->names, sizeof(char), (size_t)cache->namessize);
+
+   SCIPfclose(fp);
+
+   /* check the structure of the data */
+   *success = *success && checkSparse(cache->repbeg, cache->repinds, cache->norigvars, cache->nrepnonzeros, cache->nvars)
+      && checkSparse(cache->beg, cache->inds, cache->nconss, cache->nnonzeros, cache->nvars);
+
+   nnames = cache->nconss;
+   for( v = 0; v < cache->nvars && *success; ++v )
+   {
+      if( cache->origidxs[v] == -1 )
+         ++nnames;
+      else if( cache->origidxs[v] < 0 || cache->origidxs[v] >= cache->norigvars )
+         *success = FALSE;
+
+      if( cache->vartypes[v] != (char)SCIP_VARTYPE_BINARY && cache->vartypes[v] != (char)SCIP_VARTYPE_INTEGER
+         && cache->vartypes[v] != (char)SCIP_VARTYPE_CONTINUOUS )
+         *success = FALSE;
+
+      if( cache->impltypes[v] != (char)SCIP_IMPLINTTYPE_NONE && cache->impltypes[v] != (char)SCIP_IMPLINTTYPE_WEAK
+         && cache->impltypes[v] != (char)SCIP_IMPLINTTYPE_STRONG )
+         *success = FALSE;
+   }
+
+   /* check that the name block consists of the expected number of null-terminated names */
+   if( *success )
+   {
+      SCIP_Longint i;
+
+      for( i = 0; i < cache->namessize; ++i )
+      {
+         if( cache->names[i] == '\0' )
+            --nnames;
+      }
+
+      *success = nnames == 0 && (cache->namessize == 0 || cache->names[cache->namessize - 1] == '\0');
+   }
+
+   if( !*success )
+   {
+      SCIPwarningMessage(scip, "ignoring invalid cache file <%s>\n", filename);
+      cacheFree(scip, cache);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** replaces the problem by a cached presolved problem; if the problem was already modified by other plugins or the
+ *  cached solution is not feasible, the problem is left unchanged
+ */
+static
+SCIP_RETCODE cacheApply(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PRESOLCACHE*          cache,              /**< cached problem */
+   int*                  nfixedvars,         /**< pointer to count number of fixed variables */
+   int*                  naggrvars,          /**< pointer to count number of aggregated variables */
+   int*                  nchgvartypes,       /**< pointer to count number of changed variable types */
+   int*                  nchgbds,            /**< pointer to count number of changed bounds */
+   int*                  ndelconss,          /**< pointer to count number of deleted constraints */
+   int*                  naddconss,          /**< pointer to count number of added constraints */
+   SCIP_RESULT*          result              /**< pointer to store the result of the presolving call */
+   )
+{
+   SCIP_VAR** origvars;
+   SCIP_VAR** vars;
+   SCIP_VAR** consvars;
+   SCIP_CONS** conss;
+   const char* name;
+   SCIP_Bool infeasible;
+   int nconss;
+   int i;
+   int c;
+   int v;
+
+   assert(cache != NULL);
+   assert(result != NULL);
+
+   origvars = SCIPgetOrigVars(scip);
+
+   /* the problem must not have been modified by other plugins yet */
+   if( SCIPgetNVars(scip) != cache->norigvars )
+      return SCIP_OKAY;
+
+   for( i = 0; i < cache->norigvars; ++i )
+   {
+      if( SCIPvarGetTransVar(origvars[i]) == NULL || !SCIPvarIsActive(SCIPvarGetTransVar(origvars[i])) )
+         return SCIP_OKAY;
+   }
+
+   /* add the cached solution first, because the reductions may rely on the cutoff bound it implies */
+   if( cache->solvals != NULL )
+   {
+      SCIP_SOL* sol;
+      SCIP_Bool feasible;
+      SCIP_Bool stored;
+
+      SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, sol, cache->norigvars, origvars, cache->solvals) );
+      SCIP_CALL( SCIPcheckSolOrig(scip, sol, &feasible, FALSE, FALSE) );
+
+      if( !feasible )
+      {
+         SCIPwarningMessage(scip, "ignoring cached presolved problem, because its solution is not feasible\n");
+         SCIP_CALL( SCIPfreeSol(scip, &sol) );
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, FALSE, FALSE, FALSE, &stored) );
+   }
+
+   /* delete the constraints of the original problem, they are replaced by the cached ones below */
+   nconss = SCIPgetNConss(scip);
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &conss, SCIPgetConss(scip), MAX(nconss, 1)) );
+
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_CALL( SCIPdelCons(scip, conss[c]) );
+      ++(*ndelconss);
+   }
+
+   SCIPfreeBufferArray(scip, &conss);
+
+   /* collect the active variables of the cached problem and create the variables without original counterpart */
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, MAX(cache->nvars, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvars, MAX(cache->nvars, 1)) );
+
+   name = cache->names;
+   for( v = 0; v < cache->nvars; ++v )
+   {
+      if( cache->origidxs[v] >= 0 )
+      {
+         vars[v] = SCIPvarGetTransVar(origvars[cache->origidxs[v]]);
+         SCIP_CALL( SCIPcaptureVar(scip, vars[v]) );
+      }
+      else
+      {
+         assert(name != NULL);
+
+         SCIP_CALL( SCIPcreateVarImpl(scip, &vars[v], name, cache->lbs[v], cache->ubs[v], 0.0,
+               (SCIP_VARTYPE)cache->vartypes[v], (SCIP_IMPLINTTYPE)cache->impltypes[v], TRUE, TRUE,
+               NULL, NULL, NULL, NULL, NULL) );
+         SCIP_CALL( SCIPaddVar(scip, vars[v]) );
+         name += strlen(name) + 1;
+      }
+   }
+
+   infeasible = FALSE;
+
+   /* tighten bounds and change types of the active variables */
+   for( v = 0; v < cache->nvars && !infeasible; ++v )
+   {
+      SCIP_Bool tightened;
+
+      SCIP_CALL( SCIPtightenVarLb(scip, vars[v], cache->lbs[v], TRUE, &infeasible, &tightened) );
+      if( tightened )
+         ++(*nchgbds);
+
+      if( !infeasible )
+      {
+         SCIP_CALL( SCIPtightenVarUb(scip, vars[v], cache->ubs[v], TRUE, &infeasible, &tightened) );
+         if( tightened )
+            ++(*nchgbds);
+      }
+
+      if( !infeasible && SCIPvarGetType(vars[v]) != (SCIP_VARTYPE)cache->vartypes[v] )
+      {
+         SCIP_CALL( SCIPchgVarType(scip, vars[v], (SCIP_VARTYPE)cache->vartypes[v], &infeasible) );
+         ++(*nchgvartypes);
+      }
+
+      if( !infeasible && SCIPvarGetImplType(vars[v]) != (SCIP_IMPLINTTYPE)cache->impltypes[v] )
+      {
+         SCIP_CALL( SCIPchgVarImplType(scip, vars[v], (SCIP_IMPLINTTYPE)cache->impltypes[v], &infeasible) );
+         ++(*nchgvartypes);
+      }
+   }
+
+   /* fix or aggregate the original variables that are not active in the cached problem; SCIP may choose to aggregate
+    * in the other direction, which yields an equivalent problem
+    */
+   for( i = 0; i < cache->norigvars && !infeasible; ++i )
+   {
+      SCIP_VAR* transvar;
+      SCIP_Bool fixed;
+      int beg;
+      int nrep;
+
+      transvar = SCIPvarGetTransVar(origvars[i]);
+      beg = cache->repbeg[i];
+      nrep = cache->repbeg[i + 1] - beg;
+
+      /* skip variables that stay active */
+      if( nrep == 1 && vars[cache->repinds[beg]] == transvar && cache->repvals[beg] == 1.0 /*lint !e777*/
+         && cache->repconsts[i] == 0.0 ) /*lint !e777*/
+         continue;
+
+      if( nrep == 0 )
+      {
+         SCIP_CALL( SCIPfixVar(scip, transvar, cache->repconsts[i], &infeasible, &fixed) );
+         if( fixed )
+            ++(*nfixedvars);
+         continue;
+      }
+
+      for( v = 0; v < nrep; ++v )
+         consvars[v] = vars[cache->repinds[beg + v]];
+
+      SCIP_CALL( SCIPmultiaggregateVar(scip, transvar, nrep, consvars, &cache->repvals[beg], cache->repconsts[i],
+            &infeasible, &fixed) );
+
+      if( fixed )
+         ++(*naggrvars);
+      else if( !infeasible )
+      {
+         SCIP_CONS* cons;
+         char consname[SCIP_MAXSTRLEN];
+
+         /* keep the representation as linear constraint if the variable may not be aggregated */
+         (void)SCIPsnprintf(consname, SCIP_MAXSTRLEN, "cache_%s", SCIPvarGetName(transvar));
+         SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, consname, nrep, consvars, &cache->repvals[beg],
+               -cache->repconsts[i], -cache->repconsts[i]) );
+         SCIP_CALL( SCIPaddCoefLinear(scip, cons, transvar, -1.0) );
+         SCIP_CALL( SCIPaddCons(scip, cons) );
+         SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+         ++(*naddconss);
+      }
+   }
+
+   /* add the cached constraints */
+   for( c = 0; c < cache->nconss && !infeasible; ++c )
+   {
+      SCIP_CONS* cons;
+      unsigned int flags;
+      int beg;
+      int nconsvars;
+
+      assert(name != NULL);
+
+      flags = cache->consflags[c];
+      beg = cache->beg[c];
+      nconsvars = cache->beg[c + 1] - beg;
+
+      for( v = 0; v < nconsvars; ++v )
+         consvars[v] = vars[cache->inds[beg + v]];
+
+      SCIP_CALL( SCIPcreateConsLinear(scip, &cons, name, nconsvars, consvars, &cache->vals[beg], cache->lhss[c],
+            cache->rhss[c], (flags & CONSFLAG_INITIAL) != 0, (flags & CONSFLAG_SEPARATE) != 0,
+            (flags & CONSFLAG_ENFORCE) != 0, (flags & CONSFLAG_CHECK) != 0, (flags & CONSFLAG_PROPAGATE) != 0, FALSE,
+            (flags & CONSFLAG_MODIFIABLE) != 0, (flags & CONSFLAG_DYNAMIC) != 0, (flags & CONSFLAG_REMOVABLE) != 0,
+            (flags & CONSFLAG_STICKINGATNODE) != 0) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+      ++(*naddconss);
+
+      name += strlen(name) + 1;
+   }
+
+   for( v = cache->nvars - 1; v >= 0; --v )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[v]) );
+   }
+
+   SCIPfreeBufferArray(scip, &consvars);
+   SCIPfreeBufferArray(scip, &vars);
+
+   *result = infeasible ? SCIP_CUTOFF : SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+/** checks whether the cache can be used for the current problem and parameter settings */
+static
+SCIP_RETCODE isCacheApplicable(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Bool*            applicable          /**< pointer to store whether the cache can be used */
+   )
+{
+   SCIP_Bool symenabled;
+   int symtiming;
+
+   assert(applicable != NULL);
+
+   *applicable = FALSE;
+
+   if( SCIPgetNRuns(scip) > 1 || SCIPisExact(scip) || SCIPisReoptEnabled(scip) || SCIPgetNActivePricers(scip) > 0
+      || SCIPgetNActiveBenders(scip) > 0 )
+      return SCIP_OKAY;
+
+   /* symmetry handling methods that are added before presolving would end up in the cached problem */
+   SCIP_CALL( SCIPgetBoolParam(scip, "symmetries/enabled", &symenabled) );
+   SCIP_CALL( SCIPgetIntParam(scip, "symmetries/tryaddtiming", &symtiming) );
+
+   *applicable = !symenabled || symtiming != (int)SYM_TIMING_BEFOREPRESOL;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of presolver
+ */
+
+/** destructor of presolver to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_PRESOLFREE(presolFreeCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   SCIPfreeBlockMemory(scip, &presoldata);
+   SCIPpresolSetData(presol, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** presolving initialization method of presolver (called when presolving is about to begin) */
+static
+SCIP_DECL_PRESOLINITPRE(presolInitpreCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   presoldata->enabled = FALSE;
+   presoldata->triedload = FALSE;
+   presoldata->loaded = FALSE;
+   presoldata->written = FALSE;
+
+   if( presoldata->directory[0] == '\0' )
+      return SCIP_OKAY;
+
+   SCIP_CALL( isCacheApplicable(scip, &presoldata->enabled) );
+
+   if( presoldata->enabled )
+   {
+      SCIP_CALL( computeHash(scip, &presoldata->hash, &presoldata->enabled) );
+
+      if( !presoldata->enabled )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+            "presolved problem is not cached, because the original problem is not linear\n");
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of presolver */
+static
+SCIP_DECL_PRESOLEXEC(presolExecCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+   PRESOLCACHE cache;
+   char filename[SCIP_MAXSTRLEN];
+   SCIP_Bool success;
+
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   if( !presoldata->enabled )
+      return SCIP_OKAY;
+
+   getCacheFilename(presoldata, filename);
+   BMSclearMemory(&cache);
+
+   /* in the first call, try to replace the problem by the cached presolved problem */
+   if( !presoldata->triedload )
+   {
+      presoldata->triedload = TRUE;
+      *result = SCIP_DIDNOTFIND;
+
+      SCIP_CALL( cacheRead(scip, presoldata->hash, &cache, filename, &success) );
+
+      if( success )
+      {
+         SCIP_CALL( cacheApply(scip, &cache, nfixedvars, naggrvars, nchgvartypes, nchgbds, ndelconss, naddconss,
+               result) );
+         cacheFree(scip, &cache);
+
+         if( *result != SCIP_DIDNOTFIND )
+         {
+            presoldata->loaded = TRUE;
+
+            SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) presolved problem loaded from cache file <%s>\n",
+               SCIPgetSolvingTime(scip), filename);
+         }
+      }
+
+      return SCIP_OKAY;
+   }
+
+   /* when presolving is about to finish, write the presolved problem if it was not loaded from the cache */
+   if( (presoltiming & SCIP_PRESOLTIMING_FINAL) != 0 && !presoldata->loaded && !presoldata->written )
+   {
+      SCIP_RETCODE retcode;
+
+      presoldata->written = TRUE;
+      *result = SCIP_DIDNOTFIND;
+
+      SCIP_CALL( cacheCollect(scip, &cache, &success) );
+
+      if( success )
+      {
+         retcode = cacheWrite(scip, presoldata->hash, &cache, filename);
+
+         /* failing to write the cache should not stop the solving process */
+         if( retcode == SCIP_OKAY )
+         {
+            SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) presolved problem written to cache file <%s>\n",
+               SCIPgetSolvingTime(scip), filename);
+         }
+         else if( retcode != SCIP_FILECREATEERROR && retcode != SCIP_WRITEERROR )
+         {
+            cacheFree(scip, &cache);
+            SCIP_CALL( retcode );
+         }
+      }
+
+      cacheFree(scip, &cache);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * presolver specific interface methods
+ */
+
+/** creates the cache presolver and includes it in SCIP */
+SCIP_RETCODE SCIPincludePresolCache(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PRESOLDATA* presoldata;
+   SCIP_PRESOL* presol;
+
+   /* create cache presolver data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &presoldata) );
+   BMSclearMemory(presoldata);
+
+   /* include presolver; it is not copied to sub-SCIPs, which should not read or write cache files */
+   SCIP_CALL( SCIPincludePresolBasic(scip, &presol, PRESOL_NAME, PRESOL_DESC, PRESOL_PRIORITY, PRESOL_MAXROUNDS,
+         PRESOL_TIMING, presolExecCache, presoldata) );
+   assert(presol != NULL);
+
+   SCIP_CALL( SCIPsetPresolFree(scip, presol, presolFreeCache) );
+   SCIP_CALL( SCIPsetPresolInitpre(scip, presol, presolInitpreCache) );
+
+   /* add cache presolver parameters */
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "presolving/" PRESOL_NAME "/directory",
+         "directory to store presolved problems in, which are reloaded when the same problem is solved again with the same presolving relevant parameters (\"\": disable cache)",
+         &presoldata->directory, FALSE, DEFAULT_DIRECTORY, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,76 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   presol_cache.h
+ * @ingroup PRESOLVERS
+ * @brief  cache presolver: stores presolved problems on disk and reloads them when the same instance is solved again
+ *
+ * If a cache directory is given by the parameter presolving/cache/directory, this presolver computes a hash value of
+ * the original problem and of all non-default parameters that may influence presolving. When presolving reaches its
+ * final round, the presolved problem is written to a file named by this hash value. It consists of
+ *
+ * - the active variables with their global bounds and types,
+ * - the representation of each original variable as an affine linear combination of the active variables,
+ * - the constraints, which have to be representable as linear constraints, and
+ * - the values of the best known solution, which may have been used by reductions based on the cutoff bound.
+ *
+ * When the same problem is solved again with the same relevant parameters, e.g., with a different time limit or with
+ * different heuristic settings, the presolver reloads the cached problem in its first call: all original variables are
+ * fixed, aggregated, or multi-aggregated as in the cached problem, and the constraints are replaced by the cached
+ * ones. Therefore, solutions of the presolved problem are mapped back to the original variables as usual. Presolving
+ * continues on the reloaded problem, but only has to detect the reductions that were not yet found when the cache was
+ * written.
+ *
+ * The cache is only used in the first run of a problem without active pricers or Benders' decompositions, when neither
+ * reoptimization nor exact solving is enabled, and when symmetry handling is not added before presolving. The cache is
+ * not written if one of the constraints cannot be represented as a linear constraint.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_PRESOL_CACHE_H__
+#define __SCIP_PRESOL_CACHE_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the cache presolver and includes it in SCIP
+ *
+ * @ingroup PresolverIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludePresolCache(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
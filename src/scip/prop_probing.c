@@ -34,6 +34,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/prop_probing.h"
+#include "scip/pub_event.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
@@ -41,6 +42,7 @@
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_event.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -70,6 +72,9 @@
                                          *   limit) */
 #define MAXDNOM                 10000LL /**< maximal denominator for simple rational fixed values */
 
+#define EVENTHDLR_NAME         "probing"
+#define EVENTHDLR_DESC         "global bound change event handler for probing propagator"
+
 
 /* @todo check for restricting the maximal number of implications that can be added by probing */
 
@@ -128,6 +133,30 @@ struct SCIP_PropData
    int                   maxdepth;           /**< maximal depth until propagation is executed */
    SCIP_Longint          lastnode;           /**< last node where probing was applied, or -1 for presolving, and -2 for not applied yet */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for global bound changes of the probing variables */
+};
+
+/** variables whose bounds were changed by probing in one direction, together with their implied and propagated bounds */
+struct ProbingChgs
+{
+   int*                  pos;                /**< positions of the changed variables in the array of probing variables;
+                                              *   the variables changed by implications and cliques come first */
+   int*                  listidx;            /**< index in the pos array for each position in the array of probing
+                                              *   variables, or -1 if the variable was not changed */
+   SCIP_Real*            impllbs;            /**< lower bounds after applying implications and cliques */
+   SCIP_Real*            implubs;            /**< upper bounds after applying implications and cliques */
+   SCIP_Real*            proplbs;            /**< lower bounds after full propagation */
+   SCIP_Real*            propubs;            /**< upper bounds after full propagation */
+   int                   nimplchgs;          /**< number of variables changed by implications and cliques */
+   int                   nchgs;              /**< number of variables changed by full propagation */
+};
+typedef struct ProbingChgs PROBINGCHGS;
+
+/** event data for collecting the probing variables whose global bounds were changed */
+struct SCIP_EventData
+{
+   SCIP_HASHMAP*         varposmap;          /**< map from probing variables to their positions in the vars array */
+   PROBINGCHGS*          glbchgs;            /**< variables whose global bounds were changed; only the positions are used */
 };
 
 
@@ -338,6 +367,423 @@ SCIP_RETCODE sortVariables(
    return SCIP_OKAY;
 }
 
+/** resizes the data structure for storing the bound changes of probing in one direction to the given number of probing
+ *  variables and removes all stored bound changes
+ */
+static
+SCIP_RETCODE probingchgsRealloc(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCHGS*          chgs,               /**< bound changes of probing in one direction */
+   int                   nvars               /**< number of probing variables */
+   )
+{
+   int v;
+
+   assert(chgs != NULL);
+
+   SCIP_CALL( SCIPreallocBufferArray(scip, &chgs->pos, nvars) );
+   SCIP_CALL( SCIPreallocBufferArray(scip, &chgs->listidx, nvars) );
+   SCIP_CALL( SCIPreallocBufferArray(scip, &chgs->impllbs, nvars) );
+   SCIP_CALL( SCIPreallocBufferArray(scip, &chgs->implubs, nvars) );
+   SCIP_CALL( SCIPreallocBufferArray(scip, &chgs->proplbs, nvars) );
+   SCIP_CALL( SCIPreallocBufferArray(scip, &chgs->propubs, nvars) );
+
+   for( v = 0; v < nvars; ++v )
+      chgs->listidx[v] = -1;
+   chgs->nimplchgs = 0;
+   chgs->nchgs = 0;
+
+   return SCIP_OKAY;
+}
+
+/** creates the data structure for storing the bound changes of probing in one direction */
+static
+SCIP_RETCODE probingchgsCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCHGS*          chgs,               /**< bound changes of probing in one direction */
+   int                   nvars               /**< number of probing variables */
+   )
+{
+   assert(chgs != NULL);
+
+   chgs->pos = NULL;
+   chgs->listidx = NULL;
+   chgs->impllbs = NULL;
+   chgs->implubs = NULL;
+   chgs->proplbs = NULL;
+   chgs->propubs = NULL;
+
+   SCIP_CALL( probingchgsRealloc(scip, chgs, nvars) );
+
+   return SCIP_OKAY;
+}
+
+/** frees the data structure for storing the bound changes of probing in one direction */
+static
+void probingchgsFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCHGS*          chgs                /**< bound changes of probing in one direction */
+   )
+{
+   assert(chgs != NULL);
+
+   SCIPfreeBufferArray(scip, &chgs->propubs);
+   SCIPfreeBufferArray(scip, &chgs->proplbs);
+   SCIPfreeBufferArray(scip, &chgs->implubs);
+   SCIPfreeBufferArray(scip, &chgs->impllbs);
+   SCIPfreeBufferArray(scip, &chgs->listidx);
+   SCIPfreeBufferArray(scip, &chgs->pos);
+}
+
+/** forgets the stored bound changes of probing in one direction */
+static
+void probingchgsClear(
+   PROBINGCHGS*          chgs                /**< bound changes of probing in one direction */
+   )
+{
+   int i;
+
+   assert(chgs != NULL);
+
+   for( i = 0; i < chgs->nchgs; ++i )
+      chgs->listidx[chgs->pos[i]] = -1;
+   chgs->nimplchgs = 0;
+   chgs->nchgs = 0;
+}
+
+/** adds the variable at the given position to the stored bound changes, if it is not yet contained */
+static
+void probingchgsAdd(
+   PROBINGCHGS*          chgs,               /**< bound changes of probing in one direction */
+   int                   pos                 /**< position of the variable in the array of probing variables */
+   )
+{
+   assert(chgs != NULL);
+   assert(pos >= 0);
+
+   if( chgs->listidx[pos] >= 0 )
+      return;
+
+   chgs->listidx[pos] = chgs->nchgs;
+   chgs->pos[chgs->nchgs] = pos;
+   ++chgs->nchgs;
+}
+
+/** adds the variables whose bounds were changed in the current probing node to the stored bound changes, and stores the
+ *  current local bounds of all stored variables as bounds after applying implications and cliques or as bounds after
+ *  full propagation
+ */
+static
+void probingchgsStore(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCHGS*          chgs,               /**< bound changes of probing in one direction */
+   SCIP_VAR**            vars,               /**< probing variables */
+   SCIP_HASHMAP*         varposmap,          /**< map from probing variables to their positions in the vars array */
+   SCIP_Bool             implbounds          /**< are the current bounds the ones after applying implications and cliques? */
+   )
+{
+   SCIP_DOMCHG* domchg;
+   int nboundchgs;
+   int i;
+
+   assert(chgs != NULL);
+   assert(vars != NULL);
+   assert(varposmap != NULL);
+   assert(SCIPinProbing(scip));
+
+   domchg = SCIPnodeGetDomchg(SCIPgetCurrentNode(scip));
+   nboundchgs = SCIPdomchgGetNBoundchgs(domchg);
+
+   for( i = 0; i < nboundchgs; ++i )
+   {
+      SCIP_VAR* var;
+      int pos;
+
+      var = SCIPboundchgGetVar(SCIPdomchgGetBoundchg(domchg, i));
+
+      if( !SCIPhashmapExists(varposmap, (void*)var) )
+         continue;
+
+      pos = SCIPhashmapGetImageInt(varposmap, (void*)var);
+      assert(vars[pos] == var);
+
+      probingchgsAdd(chgs, pos);
+   }
+
+   if( implbounds )
+   {
+      for( i = 0; i < chgs->nchgs; ++i )
+      {
+         chgs->impllbs[i] = SCIPvarGetLbLocal(vars[chgs->pos[i]]);
+         chgs->implubs[i] = SCIPvarGetUbLocal(vars[chgs->pos[i]]);
+      }
+      chgs->nimplchgs = chgs->nchgs;
+   }
+   else
+   {
+      for( i = 0; i < chgs->nchgs; ++i )
+      {
+         chgs->proplbs[i] = SCIPvarGetLbLocal(vars[chgs->pos[i]]);
+         chgs->propubs[i] = SCIPvarGetUbLocal(vars[chgs->pos[i]]);
+      }
+   }
+}
+
+/** catches global bound change events of the probing variables, such that variables whose global bounds are changed
+ *  during probing are analyzed even though their changes are not recorded in the probing node
+ */
+static
+SCIP_RETCODE catchGlbBoundChgs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler for global bound changes */
+   SCIP_EVENTDATA*       eventdata,          /**< event data collecting the changed variables */
+   SCIP_VAR**            vars,               /**< probing variables */
+   int                   nvars               /**< number of probing variables */
+   )
+{
+   int i;
+
+   assert(eventhdlr != NULL);
+   assert(eventdata != NULL);
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, vars[i], SCIP_EVENTTYPE_GBDCHANGED, eventhdlr, eventdata, NULL) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** drops global bound change events of the probing variables */
+static
+SCIP_RETCODE dropGlbBoundChgs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler for global bound changes */
+   SCIP_EVENTDATA*       eventdata,          /**< event data collecting the changed variables */
+   SCIP_VAR**            vars,               /**< probing variables */
+   int                   nvars               /**< number of probing variables */
+   )
+{
+   int i;
+
+   assert(eventhdlr != NULL);
+   assert(eventdata != NULL);
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPdropVarEvent(scip, vars[i], SCIP_EVENTTYPE_GBDCHANGED, eventhdlr, eventdata, -1) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** stores the current local bounds after applying implications and cliques or after full propagation, either only for
+ *  the variables that were changed in the probing node or for all variables
+ */
+static
+void storeProbingBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< probing variables */
+   int                   nvars,              /**< number of probing variables */
+   SCIP_HASHMAP*         varposmap,          /**< map from probing variables to their positions, or NULL if chgs is NULL */
+   PROBINGCHGS*          chgs,               /**< data structure to store the bounds of the changed variables in, or NULL
+                                              *   to store the bounds of all variables in the given arrays */
+   SCIP_Real*            lbs,                /**< array to store the lower bounds of all variables, or NULL */
+   SCIP_Real*            ubs,                /**< array to store the upper bounds of all variables, or NULL */
+   SCIP_Bool             implbounds          /**< are the current bounds the ones after applying implications and cliques? */
+   )
+{
+   int i;
+
+   if( chgs != NULL )
+   {
+      probingchgsStore(scip, chgs, vars, varposmap, implbounds);
+      return;
+   }
+
+   assert(lbs != NULL);
+   assert(ubs != NULL);
+
+   for( i = 0; i < nvars; ++i )
+   {
+      lbs[i] = SCIPvarGetLbLocal(vars[i]);
+      ubs[i] = SCIPvarGetUbLocal(vars[i]);
+   }
+}
+
+/** applies and evaluates probing of a single variable in the given direction and bound
+ *
+ *  If a data structure for the bound changes is given, only the bounds of the variables that were changed in the
+ *  probing node are stored. On large problems, a single probing usually changes the bounds of few variables only, so
+ *  this avoids copying the bounds of all variables after each probing and allows to analyze only the changed variables
+ *  afterwards. Otherwise, the bounds of all variables are stored in the given arrays.
+ */
+static
+SCIP_RETCODE probeVar(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< probing variables */
+   int                   nvars,              /**< number of probing variables */
+   int                   probingpos,         /**< variable number to apply probing on */
+   SCIP_BOUNDTYPE        boundtype,          /**< which bound should be changed */
+   SCIP_Real             bound,              /**< which bound should be set */
+   int                   maxproprounds,      /**< maximal number of propagation rounds (-1: no limit, 0: parameter settings) */
+   SCIP_HASHMAP*         varposmap,          /**< map from probing variables to their positions, or NULL if chgs is NULL */
+   PROBINGCHGS*          chgs,               /**< data structure to store the bounds of the changed variables in, or NULL
+                                              *   to store the bounds of all variables in the following arrays */
+   SCIP_Real*            impllbs,            /**< array to store lower bounds after applying implications and cliques, or
+                                              *   NULL if chgs is given */
+   SCIP_Real*            implubs,            /**< array to store upper bounds after applying implications and cliques, or
+                                              *   NULL if chgs is given */
+   SCIP_Real*            proplbs,            /**< array to store lower bounds after full propagation, or NULL if chgs is
+                                              *   given */
+   SCIP_Real*            propubs,            /**< array to store upper bounds after full propagation, or NULL if chgs is
+                                              *   given */
+   SCIP_Bool*            cutoff              /**< pointer to store whether the probing direction is infeasible */
+   )
+{
+   assert(vars != NULL);
+   assert(chgs == NULL || (varposmap != NULL && chgs->nchgs == 0));
+   assert(chgs != NULL || (impllbs != NULL && implubs != NULL && proplbs != NULL && propubs != NULL));
+   assert(cutoff != NULL);
+   assert(0 <= probingpos && probingpos < nvars);
+   assert(SCIPisGE(scip, bound, SCIPvarGetLbLocal(vars[probingpos])));
+   assert(SCIPisLE(scip, bound, SCIPvarGetUbLocal(vars[probingpos])));
+
+   SCIPdebugMsg(scip, "applying probing on variable <%s> %s %g (nlocks=%d/%d, impls=%d/%d, clqs=%d/%d)\n",
+      SCIPvarGetName(vars[probingpos]), boundtype == SCIP_BOUNDTYPE_UPPER ? "<=" : ">=", bound,
+      SCIPvarGetNLocksDownType(vars[probingpos], SCIP_LOCKTYPE_MODEL),
+      SCIPvarGetNLocksUpType(vars[probingpos], SCIP_LOCKTYPE_MODEL),
+      SCIPvarGetNImpls(vars[probingpos], FALSE), SCIPvarGetNImpls(vars[probingpos], TRUE),
+      SCIPvarGetNCliques(vars[probingpos], FALSE), SCIPvarGetNCliques(vars[probingpos], TRUE));
+
+   /* in debug mode we assert above that this trivial infeasibility does not occur (for performance reasons), but in
+    * optimized mode we return safely
+    */
+   if( SCIPisLT(scip, bound, SCIPvarGetLbLocal(vars[probingpos]))
+         || SCIPisGT(scip, bound, SCIPvarGetUbLocal(vars[probingpos])) )
+   {
+      SCIPdebugMsg(scip, " -> trivial infeasibility detected\n");
+      *cutoff = TRUE;
+      return SCIP_OKAY;
+   }
+
+   /* start probing mode */
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   /* enables collection of variable statistics during probing */
+   SCIPenableVarHistory(scip);
+
+   /* fix variable */
+   if( boundtype == SCIP_BOUNDTYPE_UPPER )
+   {
+      SCIP_CALL( SCIPchgVarUbProbing(scip, vars[probingpos], bound) );
+   }
+   else
+   {
+      assert(boundtype == SCIP_BOUNDTYPE_LOWER);
+      SCIP_CALL( SCIPchgVarLbProbing(scip, vars[probingpos], bound) );
+   }
+
+   /* apply propagation of implication graph and clique table */
+   SCIP_CALL( SCIPpropagateProbingImplications(scip, cutoff) );
+   if( !(*cutoff) )
+   {
+      storeProbingBounds(scip, vars, nvars, varposmap, chgs, impllbs, implubs, TRUE);
+
+      /* apply propagation */
+      SCIP_CALL( SCIPpropagateProbing(scip, maxproprounds, cutoff, NULL) );
+   }
+   else
+   {
+      SCIPdebugMsg(scip, "propagating probing implications after <%s> to %g led to a cutoff\n",
+         SCIPvarGetName(vars[probingpos]), bound);
+   }
+
+   /* evaluate propagation */
+   if( !(*cutoff) )
+      storeProbingBounds(scip, vars, nvars, varposmap, chgs, proplbs, propubs, FALSE);
+
+   /* exit probing mode */
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** collects the variables changed by probing in at least one direction or whose global bounds were changed since the
+ *  last analysis, ordered by their positions, together with their bounds in both directions; in a direction in which a
+ *  variable was not changed in the probing node, its bounds are the current local bounds
+ */
+static
+void collectProbingChgs(
+   SCIP_VAR**            vars,               /**< probing variables */
+   PROBINGCHGS*          zerochgs,           /**< bound changes of probing the variable to zero */
+   PROBINGCHGS*          onechgs,            /**< bound changes of probing the variable to one */
+   PROBINGCHGS*          glbchgs,            /**< variables whose global bounds were changed since the last analysis */
+   int*                  chgpos,             /**< array to store the positions of the changed variables */
+   SCIP_VAR**            chgvars,            /**< array to store the changed variables */
+   SCIP_Real*            zeroimpllbs,        /**< array to store lower bounds after applying implications in zero probing */
+   SCIP_Real*            zeroimplubs,        /**< array to store upper bounds after applying implications in zero probing */
+   SCIP_Real*            zeroproplbs,        /**< array to store lower bounds after full propagation in zero probing */
+   SCIP_Real*            zeropropubs,        /**< array to store upper bounds after full propagation in zero probing */
+   SCIP_Real*            oneimpllbs,         /**< array to store lower bounds after applying implications in one probing */
+   SCIP_Real*            oneimplubs,         /**< array to store upper bounds after applying implications in one probing */
+   SCIP_Real*            oneproplbs,         /**< array to store lower bounds after full propagation in one probing */
+   SCIP_Real*            onepropubs,         /**< array to store upper bounds after full propagation in one probing */
+   int*                  nchgvars            /**< pointer to store the number of changed variables */
+   )
+{
+   int i;
+
+   assert(zerochgs != NULL);
+   assert(onechgs != NULL);
+   assert(glbchgs != NULL);
+   assert(nchgvars != NULL);
+
+   *nchgvars = 0;
+
+   for( i = 0; i < onechgs->nchgs; ++i )
+      chgpos[(*nchgvars)++] = onechgs->pos[i];
+
+   for( i = 0; i < zerochgs->nchgs; ++i )
+   {
+      if( onechgs->listidx[zerochgs->pos[i]] < 0 )
+         chgpos[(*nchgvars)++] = zerochgs->pos[i];
+   }
+
+   /* global bound changes, e.g., global fixings by propagators, are not recorded in the probing node */
+   for( i = 0; i < glbchgs->nchgs; ++i )
+   {
+      if( onechgs->listidx[glbchgs->pos[i]] < 0 && zerochgs->listidx[glbchgs->pos[i]] < 0 )
+         chgpos[(*nchgvars)++] = glbchgs->pos[i];
+   }
+
+   /* keep the order of the probing variables for the analysis */
+   SCIPsortInt(chgpos, *nchgvars);
+
+   for( i = 0; i < *nchgvars; ++i )
+   {
+      SCIP_Real lb;
+      SCIP_Real ub;
+      int idx;
+
+      chgvars[i] = vars[chgpos[i]];
+      lb = SCIPvarGetLbLocal(chgvars[i]);
+      ub = SCIPvarGetUbLocal(chgvars[i]);
+
+      idx = zerochgs->listidx[chgpos[i]];
+      zeroimpllbs[i] = (0 <= idx && idx < zerochgs->nimplchgs ? zerochgs->impllbs[idx] : lb);
+      zeroimplubs[i] = (0 <= idx && idx < zerochgs->nimplchgs ? zerochgs->implubs[idx] : ub);
+      zeroproplbs[i] = (idx >= 0 ? zerochgs->proplbs[idx] : lb);
+      zeropropubs[i] = (idx >= 0 ? zerochgs->propubs[idx] : ub);
+
+      idx = onechgs->listidx[chgpos[i]];
+      oneimpllbs[i] = (0 <= idx && idx < onechgs->nimplchgs ? onechgs->impllbs[idx] : lb);
+      oneimplubs[i] = (0 <= idx && idx < onechgs->nimplchgs ? onechgs->implubs[idx] : ub);
+      oneproplbs[i] = (idx >= 0 ? onechgs->proplbs[idx] : lb);
+      onepropubs[i] = (idx >= 0 ? onechgs->propubs[idx] : ub);
+   }
+}
+
 /** the main probing loop */
 static
 SCIP_RETCODE applyProbing(
@@ -364,6 +810,14 @@ SCIP_RETCODE applyProbing(
    SCIP_Real* oneimplubs;
    SCIP_Real* oneproplbs;
    SCIP_Real* onepropubs;
+   SCIP_HASHMAP* varposmap;
+   SCIP_VAR** chgvars;
+   SCIP_EVENTDATA eventdata;
+   PROBINGCHGS zerochgs;
+   PROBINGCHGS onechgs;
+   PROBINGCHGS glbchgs;
+   int* chgpos;
+   int nchgvars;
    int localnfixedvars;
    int localnaggrvars;
    int localnchgbds;
@@ -387,7 +841,6 @@ SCIP_RETCODE applyProbing(
    aborted = FALSE;
    looped = FALSE;
    oldstartidx = *startidx;
-   i = *startidx;
 
    /* get temporary memory for storing probing results */
    SCIP_CALL( SCIPallocBufferArray(scip, &zeroimpllbs, nvars) );
@@ -398,6 +851,23 @@ SCIP_RETCODE applyProbing(
    SCIP_CALL( SCIPallocBufferArray(scip, &oneimplubs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &oneproplbs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &onepropubs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &chgvars, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &chgpos, nvars) );
+   SCIP_CALL( probingchgsCreate(scip, &zerochgs, nvars) );
+   SCIP_CALL( probingchgsCreate(scip, &onechgs, nvars) );
+   SCIP_CALL( probingchgsCreate(scip, &glbchgs, nvars) );
+
+   /* map the variables to their positions to identify the variables changed by probing */
+   SCIP_CALL( SCIPhashmapCreate(&varposmap, SCIPblkmem(scip), nvars) );
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varposmap, (void*)vars[i], i) );
+   }
+
+   eventdata.varposmap = varposmap;
+   eventdata.glbchgs = &glbchgs;
+   SCIP_CALL( catchGlbBoundChgs(scip, propdata->eventhdlr, &eventdata, vars, nvars) );
+   i = *startidx;
 
    /* for each binary variable, probe fixing the variable to zero and one */
    *delay = FALSE;
@@ -481,6 +951,9 @@ SCIP_RETCODE applyProbing(
          propdata->nuseless++;
          propdata->ntotaluseless++;
 
+         probingchgsClear(&onechgs);
+         probingchgsClear(&zerochgs);
+
          /* determine whether one probing should happen */
          probingone = TRUE;
          if( SCIPvarGetNLocksUpType(vars[i], SCIP_LOCKTYPE_MODEL) == 0 )
@@ -489,8 +962,8 @@ SCIP_RETCODE applyProbing(
          if( probingone )
          {
             /* apply probing for fixing the variable to one */
-            SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_LOWER, 1.0, propdata->proprounds,
-                  oneimpllbs, oneimplubs, oneproplbs, onepropubs, &localcutoff) );
+            SCIP_CALL( probeVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_LOWER, 1.0, propdata->proprounds, varposmap, &onechgs,
+                  NULL, NULL, NULL, NULL, &localcutoff) );
 
             if( localcutoff )
             {
@@ -541,8 +1014,8 @@ SCIP_RETCODE applyProbing(
          if( probingzero )
          {
             /* apply probing for fixing the variable to zero */
-            SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_UPPER, 0.0, propdata->proprounds,
-                  zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, &localcutoff) );
+            SCIP_CALL( probeVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_UPPER, 0.0, propdata->proprounds, varposmap, &zerochgs,
+                  NULL, NULL, NULL, NULL, &localcutoff) );
 
             if( localcutoff )
             {
@@ -586,15 +1059,25 @@ SCIP_RETCODE applyProbing(
          /* count number of probings on each variable */
          propdata->nprobed[SCIPvarGetIndex(vars[i])] += 1;
 
-         /* analyze probing deductions */
+         /* analyze probing deductions; only variables changed in one of the probings or whose global bounds were changed
+          * can lead to deductions
+          */
+         collectProbingChgs(vars, &zerochgs, &onechgs, &glbchgs, chgpos, chgvars, zeroimpllbs, zeroimplubs, zeroproplbs,
+            zeropropubs, oneimpllbs, oneimplubs, oneproplbs, onepropubs, &nchgvars);
+
          localnfixedvars    = 0;
          localnaggrvars     = 0;
          localnimplications = 0;
          localnchgbds       = 0;
          SCIP_CALL( SCIPanalyzeDeductionsProbing(scip, vars[i], 0.0, 1.0,
-               nvars, vars, zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, oneimpllbs, oneimplubs, oneproplbs, onepropubs,
+               nchgvars, chgvars, zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, oneimpllbs, oneimplubs, oneproplbs, onepropubs,
                &localnfixedvars, &localnaggrvars, &localnimplications, &localnchgbds, cutoff) );
 
+         /* global bound changes are collected since the last analysis, which includes probings of other variables in
+          * only one direction
+          */
+         probingchgsClear(&glbchgs);
+
          *nfixedvars += localnfixedvars;
          *naggrvars  += localnaggrvars;
          *nchgbds    += localnchgbds;
@@ -636,6 +1119,8 @@ SCIP_RETCODE applyProbing(
             assert(vars == propdata->sortedvars);
             assert(nbinvars == propdata->nsortedbinvars);
 
+            SCIP_CALL( dropGlbBoundChgs(scip, propdata->eventhdlr, &eventdata, vars, nvars) );
+
             /* release old variables and free memory */
             for( v = propdata->nsortedvars - 1; v >= 0; --v )
             {
@@ -679,6 +1164,11 @@ SCIP_RETCODE applyProbing(
             SCIP_CALL( SCIPreallocBufferArray(scip, &oneimplubs, nvars) );
             SCIP_CALL( SCIPreallocBufferArray(scip, &oneproplbs, nvars) );
             SCIP_CALL( SCIPreallocBufferArray(scip, &onepropubs, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &chgvars, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &chgpos, nvars) );
+            SCIP_CALL( probingchgsRealloc(scip, &zerochgs, nvars) );
+            SCIP_CALL( probingchgsRealloc(scip, &onechgs, nvars) );
+            SCIP_CALL( probingchgsRealloc(scip, &glbchgs, nvars) );
 
             /* correct oldstartidx which is used for early termination */
             if( oldstartidx >= nbinvars )
@@ -690,6 +1180,8 @@ SCIP_RETCODE applyProbing(
                SCIP_CALL( SCIPcaptureVar(scip, propdata->sortedvars[v]) );
             }
 
+            SCIP_CALL( catchGlbBoundChgs(scip, propdata->eventhdlr, &eventdata, vars, nvars) );
+
             if( nnewbinvars == 0 )
             {
                *startidx = 0;
@@ -703,6 +1195,13 @@ SCIP_RETCODE applyProbing(
             /* resorting here might lead to probing a second time on the same variable */
             SCIP_CALL( sortVariables(scip, propdata, propdata->sortedvars, propdata->nsortedbinvars, 0) );
             propdata->lastsortstartidx = 0;
+
+            /* map the new variables to their positions */
+            SCIP_CALL( SCIPhashmapRemoveAll(varposmap) );
+            for( v = 0; v < nvars; ++v )
+            {
+               SCIP_CALL( SCIPhashmapInsertInt(varposmap, (void*)vars[v], v) );
+            }
          }
       }
    }
@@ -711,7 +1210,15 @@ SCIP_RETCODE applyProbing(
    *startidx = i;
 
  TERMINATE:
+   SCIP_CALL( dropGlbBoundChgs(scip, propdata->eventhdlr, &eventdata, vars, nvars) );
+
    /* free temporary memory */
+   SCIPhashmapFree(&varposmap);
+   probingchgsFree(scip, &glbchgs);
+   probingchgsFree(scip, &onechgs);
+   probingchgsFree(scip, &zerochgs);
+   SCIPfreeBufferArray(scip, &chgpos);
+   SCIPfreeBufferArray(scip, &chgvars);
    SCIPfreeBufferArray(scip, &onepropubs);
    SCIPfreeBufferArray(scip, &oneproplbs);
    SCIPfreeBufferArray(scip, &oneimplubs);
@@ -725,6 +1232,30 @@ SCIP_RETCODE applyProbing(
 }
 
 
+/*
+ * Callback methods of event handler
+ */
+
+/** execution method of event handler: remembers the probing variable whose global bounds were changed */
+static
+SCIP_DECL_EVENTEXEC(eventExecProbing)
+{  /*lint --e{715}*/
+   SCIP_VAR* var;
+
+   assert(eventhdlr != NULL);
+   SCIP_STRINGEQ( SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME, SCIP_INVALIDCALL );
+   assert(eventdata != NULL);
+   assert((SCIPeventGetType(event) & SCIP_EVENTTYPE_GBDCHANGED) != 0);
+
+   var = SCIPeventGetVar(event);
+
+   if( SCIPhashmapExists(eventdata->varposmap, (void*)var) )
+      probingchgsAdd(eventdata->glbchgs, SCIPhashmapGetImageInt(eventdata->varposmap, (void*)var));
+
+   return SCIP_OKAY;
+}
+
+
 /*
  * Callback methods of propagator
  */
@@ -1153,6 +1684,10 @@ SCIP_RETCODE SCIPincludePropProbing(
 
    assert(prop != NULL);
 
+   /* include event handler for global bound changes of the probing variables */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &propdata->eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
+         eventExecProbing, NULL) );
+
    /* set optional callbacks via setter functions */
    SCIP_CALL( SCIPsetPropCopy(scip, prop, propCopyProbing) );
    SCIP_CALL( SCIPsetPropFree(scip, prop, propFreeProbing) );
@@ -1220,84 +1755,9 @@ SCIP_RETCODE SCIPapplyProbingVar(
    assert(proplbs != NULL);
    assert(propubs != NULL);
    assert(cutoff != NULL);
-   assert(0 <= probingpos && probingpos < nvars);
-   assert(SCIPisGE(scip, bound, SCIPvarGetLbLocal(vars[probingpos])));
-   assert(SCIPisLE(scip, bound, SCIPvarGetUbLocal(vars[probingpos])));
-
-   SCIPdebugMsg(scip, "applying probing on variable <%s> %s %g (nlocks=%d/%d, impls=%d/%d, clqs=%d/%d)\n",
-      SCIPvarGetName(vars[probingpos]), boundtype == SCIP_BOUNDTYPE_UPPER ? "<=" : ">=", bound,
-      SCIPvarGetNLocksDownType(vars[probingpos], SCIP_LOCKTYPE_MODEL),
-      SCIPvarGetNLocksUpType(vars[probingpos], SCIP_LOCKTYPE_MODEL),
-      SCIPvarGetNImpls(vars[probingpos], FALSE), SCIPvarGetNImpls(vars[probingpos], TRUE),
-      SCIPvarGetNCliques(vars[probingpos], FALSE), SCIPvarGetNCliques(vars[probingpos], TRUE));
-
-   /* in debug mode we assert above that this trivial infeasibility does not occur (for performance reasons), but in
-    * optimized mode we return safely
-    */
-   if( SCIPisLT(scip, bound, SCIPvarGetLbLocal(vars[probingpos]))
-         || SCIPisGT(scip, bound, SCIPvarGetUbLocal(vars[probingpos])) )
-   {
-      SCIPdebugMsg(scip, " -> trivial infeasibility detected\n");
-      *cutoff = TRUE;
-      return SCIP_OKAY;
-   }
-
-   /* start probing mode */
-   SCIP_CALL( SCIPstartProbing(scip) );
-
-   /* enables collection of variable statistics during probing */
-   SCIPenableVarHistory(scip);
-
-   /* fix variable */
-   if( boundtype == SCIP_BOUNDTYPE_UPPER )
-   {
-      SCIP_CALL( SCIPchgVarUbProbing(scip, vars[probingpos], bound) );
-   }
-   else
-   {
-      assert(boundtype == SCIP_BOUNDTYPE_LOWER);
-      SCIP_CALL( SCIPchgVarLbProbing(scip, vars[probingpos], bound) );
-   }
-
-   /* @todo it might pay off to catch the bounds-tightened event on all variables and then only get the implied and
-    *       propagated bounds on those variables which where really changed on propagation
-    */
-
-   /* apply propagation of implication graph and clique table */
-   SCIP_CALL( SCIPpropagateProbingImplications(scip, cutoff) );
-   if( !(*cutoff) )
-   {
-      int i;
-
-      for( i = 0; i < nvars; ++i )
-      {
-         impllbs[i] = SCIPvarGetLbLocal(vars[i]);
-         implubs[i] = SCIPvarGetUbLocal(vars[i]);
-      }
-
-      /* apply propagation */
-      SCIP_CALL( SCIPpropagateProbing(scip, maxproprounds, cutoff, NULL) );
-   }
-   else
-   {
-      SCIPdebugMsg(scip, "propagating probing implications after <%s> to %g led to a cutoff\n",
-         SCIPvarGetName(vars[probingpos]), bound);
-   }
-
-   /* evaluate propagation */
-   if( !(*cutoff) )
-   {
-      int i;
-
-      for( i = 0; i < nvars; ++i )
-      {
-         proplbs[i] = SCIPvarGetLbLocal(vars[i]);
-         propubs[i] = SCIPvarGetUbLocal(vars[i]);
-      }
-   }
 
-   /* exit probing mode */
-   SCIP_CALL( SCIPendProbing(scip) );
+   SCIP_CALL( probeVar(scip, vars, nvars, probingpos, boundtype, bound, maxproprounds, NULL, NULL, impllbs, implubs,
+         proplbs, propubs, cutoff) );
 
    return SCIP_OKAY;
 }
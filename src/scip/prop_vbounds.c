@@ -191,16 +191,16 @@ struct SCIP_PropData
                                               *   and boundtype represented by index topoorder[i] are earlier in the
                                               *   topological order than those represented by index topoorder[j]
                                               */
-   int**                 vboundboundedidx;   /**< array storing for each bound index the bound indices of all bounds
-                                              *   influenced by this bound through variable bounds */
-   SCIP_Real**           vboundcoefs;        /**< array storing for each bound index the coefficients in the variable
-                                              *   bounds influencing the corresponding bound index stored in
-                                              *   vboundboundedidx */
-   SCIP_Real**           vboundconstants;    /**< array storing for each bound index the constants in the variable
-                                              *   bounds influencing the corresponding bound index stored in
-                                              *   vboundboundedidx */
-   int*                  nvbounds;           /**< array storing for each bound index the number of vbounds stored */
-   int*                  vboundsize;         /**< array with sizes of vbound arrays for the nodes */
+   int*                  vboundbeg;          /**< array storing for each bound index the first position of the variable
+                                              *   bounds influenced by this bound in the vboundboundedidx, vboundcoefs,
+                                              *   and vboundconstants arrays; entry nbounds gives the total number */
+   int*                  vboundboundedidx;   /**< bound indices of all bounds influenced through variable bounds, grouped
+                                              *   by the bound index influencing them */
+   SCIP_Real*            vboundcoefs;        /**< coefficients in the variable bounds influencing the corresponding bound
+                                              *   index stored in vboundboundedidx */
+   SCIP_Real*            vboundconstants;    /**< constants in the variable bounds influencing the corresponding bound
+                                              *   index stored in vboundboundedidx */
+   int                   nvbounds;           /**< total number of variable bounds stored */
    int                   nbounds;            /**< number of bounds of variables regarded (two times number of active variables) */
    int                   lastpresolncliques; /**< number of cliques created until the last call to the presolver */
    SCIP_PQUEUE*          propqueue;          /**< priority queue to handle the bounds of variables that were changed and have to be propagated */
@@ -340,11 +340,11 @@ void resetPropdata(
    propdata->vars = NULL;
    propdata->varhashmap = NULL;
    propdata->topoorder = NULL;
+   propdata->vboundbeg = NULL;
    propdata->vboundboundedidx = NULL;
    propdata->vboundcoefs = NULL;
    propdata->vboundconstants = NULL;
-   propdata->nvbounds = NULL;
-   propdata->vboundsize = NULL;
+   propdata->nvbounds = 0;
    propdata->nbounds = 0;
    propdata->initialized = FALSE;
 }
@@ -390,7 +390,7 @@ SCIP_RETCODE catchEvents(
        * we do not create an event and do not catch changes of the bound;
        * we mark this by setting the value in topoorder to -1
        */
-      if( propdata->nvbounds[idx] == 0 && SCIPvarGetNImpls(var, lower) == 0 && SCIPvarGetNCliques(var, lower) == 0 )
+      if( propdata->vboundbeg[idx] == propdata->vboundbeg[idx + 1] && SCIPvarGetNImpls(var, lower) == 0 && SCIPvarGetNCliques(var, lower) == 0 )
       {
          propdata->topoorder[v] = -1;
          continue;
@@ -456,49 +456,71 @@ SCIP_RETCODE dropEvents(
    return SCIP_OKAY;
 }
 
-#define INITMEMSIZE 5
-
-/* adds a vbound to the propagator data to store it internally and allow forward propagation */
+/** stores the collected variable bounds in the propagator data
+ *
+ *  The variable bounds are stored in common arrays, grouped by the bound index influencing them: the variable bounds
+ *  influenced by bound index i are stored at positions vboundbeg[i], ..., vboundbeg[i+1] - 1, in the order in which they
+ *  were collected. Thus, the outgoing edges of a bound, which are traversed one after another during propagation and
+ *  the depth-first search, lie next to each other in memory.
+ */
 static
-SCIP_RETCODE addVbound(
+SCIP_RETCODE storeVbounds(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_PROPDATA*        propdata,           /**< propagator data */
-   int                   startidx,           /**< index of bound of variable influencing the other variable */
-   int                   endidx,             /**< index of bound of variable which is influenced */
-   SCIP_Real             coef,               /**< coefficient in the variable bound */
-   SCIP_Real             constant            /**< constant in the variable bound */
+   int*                  startidxs,          /**< indices of bounds of variables influencing the other variables */
+   int*                  endidxs,            /**< indices of bounds of variables which are influenced */
+   SCIP_Real*            coefs,              /**< coefficients in the variable bounds */
+   SCIP_Real*            constants,          /**< constants in the variable bounds */
+   int                   nvbounds            /**< number of collected variable bounds */
    )
 {
-   int nvbounds;
+   int* nextpos;
+   int nbounds;
+   int i;
 
    assert(scip != NULL);
    assert(propdata != NULL);
+   assert(startidxs != NULL || nvbounds == 0);
+   assert(endidxs != NULL || nvbounds == 0);
+   assert(coefs != NULL || nvbounds == 0);
+   assert(constants != NULL || nvbounds == 0);
 
-   if( propdata->vboundsize[startidx] == 0 )
-   {
-      /* allocate memory for storing vbounds */
-      propdata->vboundsize[startidx] = INITMEMSIZE;
+   nbounds = propdata->nbounds;
 
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundboundedidx[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundcoefs[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundconstants[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-   }
-   else if( propdata->nvbounds[startidx] >= propdata->vboundsize[startidx] )
+   /* count the variable bounds influenced by each bound and compute the start positions */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->vboundbeg, nbounds + 1) );
+
+   for( i = 0; i < nvbounds; ++i )
+      ++(propdata->vboundbeg[startidxs[i] + 1]); /*lint !e613*/
+
+   for( i = 0; i < nbounds; ++i )
+      propdata->vboundbeg[i + 1] += propdata->vboundbeg[i];
+   assert(propdata->vboundbeg[nbounds] == nvbounds);
+
+   propdata->nvbounds = nvbounds;
+
+   if( nvbounds == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundboundedidx, nvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundcoefs, nvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundconstants, nvbounds) );
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &nextpos, propdata->vboundbeg, nbounds) );
+
+   /* distribute the variable bounds to their positions, keeping their order */
+   for( i = 0; i < nvbounds; ++i )
    {
-      /* reallocate memory for storing vbounds */
-      propdata->vboundsize[startidx] = SCIPcalcMemGrowSize(scip, propdata->nvbounds[startidx] + 1);
-      assert(propdata->nvbounds[startidx] < propdata->vboundsize[startidx]);
+      int pos;
+
+      pos = nextpos[startidxs[i]]++; /*lint !e613*/
+      assert(pos < propdata->vboundbeg[startidxs[i] + 1]); /*lint !e613*/
 
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundboundedidx[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundcoefs[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundconstants[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
+      propdata->vboundboundedidx[pos] = endidxs[i]; /*lint !e613*/
+      propdata->vboundcoefs[pos] = coefs[i]; /*lint !e613*/
+      propdata->vboundconstants[pos] = constants[i]; /*lint !e613*/
    }
 
-   nvbounds = propdata->nvbounds[startidx];
-   propdata->vboundboundedidx[startidx][nvbounds] = endidx;
-   propdata->vboundcoefs[startidx][nvbounds] = coef;
-   propdata->vboundconstants[startidx][nvbounds] = constant;
-   (propdata->nvbounds[startidx])++;
+   SCIPfreeBufferArray(scip, &nextpos);
 
    return SCIP_OKAY;
 }
@@ -725,17 +747,17 @@ SCIP_RETCODE extractCycle(
       {
          assert(stacknextedge[j] > ntmpimpls);
 
-         k = stacknextedge[j] - ntmpimpls - 1;
-         assert(k < propdata->nvbounds[dfsstack[j]]);
-         assert(propdata->vboundboundedidx[dfsstack[j]][k] == dfsstack[j+1]);
+         k = propdata->vboundbeg[dfsstack[j]] + stacknextedge[j] - ntmpimpls - 1;
+         assert(k < propdata->vboundbeg[dfsstack[j] + 1]);
+         assert(propdata->vboundboundedidx[k] == dfsstack[j+1]);
 
          SCIPdebugMsg(scip, "%s(%s) -- (*%g + %g) --> %s(%s)\n",
             indexGetBoundString(dfsstack[j]), SCIPvarGetName(vars[getVarIndex(dfsstack[j])]),
-            propdata->vboundcoefs[dfsstack[j]][k], propdata->vboundconstants[dfsstack[j]][k],
+            propdata->vboundcoefs[k], propdata->vboundconstants[k],
             indexGetBoundString(dfsstack[j+1]), SCIPvarGetName(vars[getVarIndex(dfsstack[j+1])]));
 
-         coef = coef * propdata->vboundcoefs[dfsstack[j]][k];
-         constant = constant * propdata->vboundcoefs[dfsstack[j]][k] + propdata->vboundconstants[dfsstack[j]][k];
+         coef = coef * propdata->vboundcoefs[k];
+         constant = constant * propdata->vboundcoefs[k] + propdata->vboundconstants[k];
       }
    }
 
@@ -1055,8 +1077,8 @@ SCIP_RETCODE dfs(
          int* vboundidx;
          int i;
 
-         nvbounds = propdata->nvbounds[curridx];
-         vboundidx = propdata->vboundboundedidx[curridx];
+         nvbounds = propdata->vboundbeg[curridx + 1] - propdata->vboundbeg[curridx];
+         vboundidx = &propdata->vboundboundedidx[propdata->vboundbeg[curridx]];
 
          /* iterate over all vbounds for the given bound */
          for( i = stacknextedge[stacksize - 1] - nimpls; i < nvbounds; ++i )
@@ -1182,6 +1204,12 @@ SCIP_RETCODE initData(
 {
    SCIP_PROPDATA* propdata;
    SCIP_VAR** vars;
+   SCIP_Real* vboundcoefs;
+   SCIP_Real* vboundconstants;
+   int* vboundstartidxs;
+   int* vboundendidxs;
+   int maxnvbounds;
+   int nvbounds;
    int nvars;
    int nbounds;
    int startidx;
@@ -1231,26 +1259,20 @@ SCIP_RETCODE initData(
 
    /* allocate memory for the arrays of the propdata */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->topoorder, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundboundedidx, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundcoefs, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundconstants, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->nvbounds, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundsize, nbounds) );
-   BMSclearMemoryArray(propdata->vboundboundedidx, nbounds);
-   BMSclearMemoryArray(propdata->vboundcoefs, nbounds);
-   BMSclearMemoryArray(propdata->vboundconstants, nbounds);
-   BMSclearMemoryArray(propdata->nvbounds, nbounds);
-   BMSclearMemoryArray(propdata->vboundsize, nbounds);
 
    for( v = 0; v < nbounds; ++v )
-   {
       propdata->topoorder[v] = v;
-      propdata->vboundboundedidx[v] = NULL;
-      propdata->vboundcoefs[v] = NULL;
-      propdata->vboundconstants[v] = NULL;
-      propdata->nvbounds[v] = 0;
-      propdata->vboundsize[v] = 0;
-   }
+
+   /* allocate temporary memory for collecting the varbounds */
+   maxnvbounds = 0;
+   for( v = 0; v < nvars; ++v )
+      maxnvbounds += SCIPvarGetNVlbs(vars[v]) + SCIPvarGetNVubs(vars[v]);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &vboundstartidxs, maxnvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vboundendidxs, maxnvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vboundcoefs, maxnvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vboundconstants, maxnvbounds) );
+   nvbounds = 0;
 
    /* collect information about varbounds */
    for( v = 0; v < nbounds; ++v )
@@ -1322,7 +1344,12 @@ SCIP_RETCODE initData(
          }
          else
          {
-            SCIP_CALL( addVbound(scip, propdata, startidx, v, coef, constant) );
+            assert(nvbounds < maxnvbounds);
+            vboundstartidxs[nvbounds] = startidx;
+            vboundendidxs[nvbounds] = v;
+            vboundcoefs[nvbounds] = coef;
+            vboundconstants[nvbounds] = constant;
+            ++nvbounds;
 
             SCIPdebugMsg(scip, "varbound <%s> %s %g * <%s> + %g added to propagator data\n",
                SCIPvarGetName(var), (lower ? ">=" : "<="), coef,
@@ -1331,6 +1358,14 @@ SCIP_RETCODE initData(
       }
    }
 
+   /* store the varbounds grouped by the influencing bound */
+   SCIP_CALL( storeVbounds(scip, propdata, vboundstartidxs, vboundendidxs, vboundcoefs, vboundconstants, nvbounds) );
+
+   SCIPfreeBufferArray(scip, &vboundconstants);
+   SCIPfreeBufferArray(scip, &vboundcoefs);
+   SCIPfreeBufferArray(scip, &vboundendidxs);
+   SCIPfreeBufferArray(scip, &vboundstartidxs);
+
    /* sort the bounds topologically */
    if( propdata->dotoposort )
    {
@@ -2055,17 +2090,17 @@ SCIP_RETCODE propagateVbounds(
          SCIP_Real constant;
 
          /* iterate over all vbounds for the given bound */
-         for( n = 0; n < propdata->nvbounds[startpos]; ++n )
+         for( n = propdata->vboundbeg[startpos]; n < propdata->vboundbeg[startpos + 1]; ++n )
          {
-            boundedvar = vars[getVarIndex(propdata->vboundboundedidx[startpos][n])];
-            coef = propdata->vboundcoefs[startpos][n];
-            constant = propdata->vboundconstants[startpos][n];
+            boundedvar = vars[getVarIndex(propdata->vboundboundedidx[n])];
+            coef = propdata->vboundcoefs[n];
+            constant = propdata->vboundconstants[n];
 
             /* compute new bound */
             newbound = startbound * coef + constant;
 
             /* try to tighten the bound */
-            if( isIndexLowerbound(propdata->vboundboundedidx[startpos][n]) )
+            if( isIndexLowerbound(propdata->vboundboundedidx[n]) )
             {
                SCIP_CALL( tightenVarLb(scip, prop, propdata, boundedvar, newbound, global, startvar, starttype, force,
                      coef, constant, TRUE, &nchgbds, result) );
@@ -2166,7 +2201,6 @@ static
 SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
 {  /*lint --e{715}*/
    SCIP_PROPDATA* propdata;
-   int v;
 
    propdata = SCIPpropGetData(prop);
    assert(propdata != NULL);
@@ -2177,27 +2211,14 @@ SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
       /* drop all variable events */
       SCIP_CALL( dropEvents(scip, propdata) );
 
-      /* release all variables */
-      for( v = 0; v < propdata->nbounds; ++v )
-      {
-         /* free vbound data */
-         if( propdata->vboundsize[v] > 0 )
-         {
-            SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundcoefs[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundconstants[v]);
-         }
-      }
-
       /* free priority queue */
       SCIPpqueueFree(&propdata->propqueue);
 
       /* free arrays */
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundsize, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->nvbounds, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundconstants, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundcoefs, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundboundedidx, propdata->nbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundconstants, propdata->nvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundcoefs, propdata->nvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundboundedidx, propdata->nvbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->vboundbeg, propdata->nbounds + 1);
       SCIPfreeBlockMemoryArray(scip, &propdata->inqueue, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->topoorder, propdata->nbounds);
 
@@ -3031,8 +3052,8 @@ SCIP_DECL_PROPRESPROP(propRespropVbounds)
       int nvbounds;
       int b;
 
-      nvbounds = propdata->nvbounds[pos];
-      vboundboundedidx = propdata->vboundboundedidx[pos];
+      nvbounds = propdata->vboundbeg[pos + 1] - propdata->vboundbeg[pos];
+      vboundboundedidx = &propdata->vboundboundedidx[propdata->vboundbeg[pos]];
 
       inferidx = boundtype == SCIP_BOUNDTYPE_LOWER ? varGetLbIndex(propdata, infervar) : varGetUbIndex(propdata, infervar);
       assert(inferidx >= 0);
@@ -3044,8 +3065,8 @@ SCIP_DECL_PROPRESPROP(propRespropVbounds)
       }
       assert(b < nvbounds);
 
-      coef = propdata->vboundcoefs[pos][b];
-      constant = propdata->vboundconstants[pos][b];
+      coef = propdata->vboundcoefs[propdata->vboundbeg[pos] + b];
+      constant = propdata->vboundconstants[propdata->vboundbeg[pos] + b];
       assert(!SCIPisZero(scip, coef));
 
       /* compute the relaxed bound which is sufficient to propagate the inference bound of given variable */
@@ -476,6 +476,21 @@ void SCIPconshdlrSetNeedsCons(
    SCIP_Bool             needscons           /**< should be skipped, if no constraints are available? */
    );
 
+/** does the propagation method of the constraint handler only process constraints marked for propagation? */
+SCIP_EXPORT
+SCIP_Bool SCIPconshdlrIsPropMarkedOnly(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   );
+
+/** sets the propmarkedonly flag of constraint handler; if it is set, the propagation method is only called if a
+ *  constraint of the handler is marked for propagation
+ */
+SCIP_EXPORT
+void SCIPconshdlrSetPropMarkedOnly(
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_Bool             propmarkedonly      /**< does the propagation method only process marked constraints? */
+   );
+
 /** does the constraint handler perform presolving? */
 SCIP_EXPORT
 SCIP_Bool SCIPconshdlrDoesPresolve(
@@ -44,6 +44,16 @@
 extern "C" {
 #endif
 
+/** returns whether an arbitrary SCIP constraint is of a type that can be represented as a single linear constraint,
+ *  i.e., whether SCIPconsGetLhs() and SCIPconsGetRhs() can return its sides
+ *
+ *  @note This check does not print a warning for other constraints, in contrast to the getters of the sides.
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPconsIsLinearRepresentable(
+   SCIP_CONS*            cons                /**< constraint to check */
+   );
+
 /** returns the right-hand side of an arbitrary SCIP constraint that can be represented as a single linear constraint
  *
  *  @note The success pointer indicates if the individual contraint handler was able to return the involved values
@@ -0,0 +1,716 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_snp.c
+ * @ingroup DEFPLUGINS_READER
+ * @brief  SNP file reader and writer for binary snapshots of linear problems
+ *
+ * See reader_snp.h for a description of the file format.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/binaryio.h"
+#include "scip/cons_linear.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_linear.h"
+#include "scip/pub_reader.h"
+#include "scip/pub_var.h"
+#include "scip/reader_snp.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_exact.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_reader.h"
+#include "scip/scip_var.h"
+#include <string.h>
+
+
+#define READER_NAME             "snpreader"
+#define READER_DESC             "file reader and writer for binary snapshots of mixed-integer linear programs"
+#define READER_EXTENSION        "snp"
+
+#define SNP_MAGIC               "SCIPSNP"    /**< magic string at the beginning of each file */
+#define SNP_VERSION             1            /**< version of the file format */
+
+/** header of an snp file */
+struct SnpHeader
+{
+   SCIP_BINARYHEADER     binary;             /**< magic string SNP_MAGIC, format version, and byte order mark */
+   int                   objsense;           /**< objective sense */
+   int                   nvars;              /**< number of variables */
+   int                   nconss;             /**< number of constraints */
+   int                   nnonzeros;          /**< number of nonzeros of the constraint matrix */
+   SCIP_Longint          namessize;          /**< size of the name block in bytes */
+   SCIP_Real             objoffset;          /**< objective offset */
+};
+typedef struct SnpHeader SNPHEADER;
+
+
+/*
+ * Local methods
+ */
+
+/** converts a value to the file representation, where infinite values are stored as the largest double */
+static
+SCIP_Real valueToFile(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             val                 /**< value to convert */
+   )
+{
+   if( SCIPisInfinity(scip, val) )
+      return SCIP_REAL_MAX;
+   if( SCIPisInfinity(scip, -val) )
+      return -SCIP_REAL_MAX;
+   return val;
+}
+
+/** converts a value of the file representation to SCIP's infinity */
+static
+SCIP_Real valueFromFile(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             val                 /**< value to convert */
+   )
+{
+   if( SCIPisInfinity(scip, val) )
+      return SCIPinfinity(scip);
+   if( SCIPisInfinity(scip, -val) )
+      return -SCIPinfinity(scip);
+   return val;
+}
+
+/** reads a problem in snp format */
+static
+SCIP_RETCODE readSnp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           filename            /**< name of the input file */
+   )
+{
+   SNPHEADER header;
+   SCIP_FILE* fp;
+   SCIP_RETCODE retcode;
+   SCIP_VAR** vars = NULL;
+   SCIP_VAR** rowvars = NULL;
+   const char** consnames = NULL;
+   SCIP_Real* lbs = NULL;
+   SCIP_Real* ubs = NULL;
+   SCIP_Real* objs = NULL;
+   SCIP_Real* lhss = NULL;
+   SCIP_Real* rhss = NULL;
+   SCIP_Real* vals = NULL;
+   int* beg = NULL;
+   int* inds = NULL;
+   char* vartypes = NULL;
+   char* impltypes = NULL;
+   char* names = NULL;
+   const char* name;
+   SCIP_Bool initialconss;
+   SCIP_Bool dynamicconss;
+   SCIP_Bool dynamiccols;
+   SCIP_Bool dynamicrows;
+   int nvars;
+   int nconss;
+   int maxrowlen;
+   int i;
+
+   assert(scip != NULL);
+   assert(filename != NULL);
+
+   fp = SCIPfopen(filename, "rb");
+   if( fp == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_NOFILE;
+   }
+
+   retcode = SCIP_READERROR;
+
+   if( !SCIPbinaryReadArray(fp, &header, sizeof(header), 1) )
+   {
+      SCIPerrorMessage("file <%s> is not a snapshot file\n", filename);
+      goto TERMINATE;
+   }
+
+   switch( SCIPbinaryCheckHeader(&header.binary, SNP_MAGIC, SNP_VERSION) )
+   {
+   case SCIP_BINARYSTATUS_OK:
+      break;
+   case SCIP_BINARYSTATUS_WRONGTYPE:
+      SCIPerrorMessage("file <%s> is not a snapshot file\n", filename);
+      goto TERMINATE;
+   case SCIP_BINARYSTATUS_SWAPPED:
+      SCIPerrorMessage("snapshot file <%s> was written on a machine of different byte order\n", filename);
+      goto TERMINATE;
+   case SCIP_BINARYSTATUS_VERSION:
+      SCIPerrorMessage("snapshot file <%s> has unsupported version %d\n", filename, header.binary.version);
+      goto TERMINATE;
+   case SCIP_BINARYSTATUS_CORRUPTED:
+   default:
+      SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+      goto TERMINATE;
+   }
+   if( (header.objsense != (int)SCIP_OBJSENSE_MINIMIZE && header.objsense != (int)SCIP_OBJSENSE_MAXIMIZE)
+      || header.nvars < 0 || header.nconss < 0 || header.nnonzeros < 0 || header.namessize <= 0 )
+   {
+      SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+      goto TERMINATE;
+   }
+
+   nvars = header.nvars;
+   nconss = header.nconss;
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &lbs, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &ubs, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &objs, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &lhss, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &rhss, nconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &vals, header.nnonzeros), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &beg, nconss + 1), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &inds, header.nnonzeros), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &vartypes, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &impltypes, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &names, header.namessize), TERMINATE );
+   retcode = SCIP_READERROR;
+
+   if( !SCIPbinaryReadArray(fp, lbs, sizeof(SCIP_Real), (size_t)nvars)
+      || !SCIPbinaryReadArray(fp, ubs, sizeof(SCIP_Real), (size_t)nvars)
+      || !SCIPbinaryReadArray(fp, objs, sizeof(SCIP_Real), (size_t)nvars)
+      || !SCIPbinaryReadArray(fp, lhss, sizeof(SCIP_Real), (size_t)nconss)
+      || !SCIPbinaryReadArray(fp, rhss, sizeof(SCIP_Real), (size_t)nconss)
+      || !SCIPbinaryReadArray(fp, vals, sizeof(SCIP_Real), (size_t)header.nnonzeros)
+      || !SCIPbinaryReadArray(fp, beg, sizeof(int), (size_t)nconss + 1)
+      || !SCIPbinaryReadArray(fp, inds, sizeof(int), (size_t)header.nnonzeros)
+      || !SCIPbinaryReadArray(fp, vartypes, sizeof(char), (size_t)nvars)
+      || !SCIPbinaryReadArray(fp, impltypes, sizeof(char), (size_t)nvars)
+      || !SCIPbinaryReadArray(fp, names, sizeof(char), (size_t)header.namessize) )
+   {
+      SCIPerrorMessage("unexpected end of snapshot file <%s>\n", filename);
+      goto TERMINATE;
+   }
+
+   /* check the consistency of the data, such that a corrupted file cannot lead to invalid memory accesses */
+   if( beg[0] != 0 || beg[nconss] != header.nnonzeros || names[header.namessize - 1] != '\0' )
+   {
+      SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+      goto TERMINATE;
+   }
+   maxrowlen = 1;
+   for( i = 0; i < nconss; ++i )
+   {
+      if( beg[i] > beg[i + 1] )
+      {
+         SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+         goto TERMINATE;
+      }
+      maxrowlen = MAX(maxrowlen, beg[i + 1] - beg[i]);
+   }
+   for( i = 0; i < header.nnonzeros; ++i )
+   {
+      if( inds[i] < 0 || inds[i] >= nvars )
+      {
+         SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+         goto TERMINATE;
+      }
+   }
+   for( i = 0; i < nvars; ++i )
+   {
+      if( (vartypes[i] != (char)SCIP_VARTYPE_BINARY && vartypes[i] != (char)SCIP_VARTYPE_INTEGER
+            && vartypes[i] != (char)SCIP_VARTYPE_CONTINUOUS) || impltypes[i] < (char)SCIP_IMPLINTTYPE_NONE
+         || impltypes[i] > (char)SCIP_IMPLINTTYPE_STRONG )
+      {
+         SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+         goto TERMINATE;
+      }
+   }
+
+   SCIP_CALL_TERMINATE( retcode, SCIPgetBoolParam(scip, "reading/initialconss", &initialconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPgetBoolParam(scip, "reading/dynamicconss", &dynamicconss), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPgetBoolParam(scip, "reading/dynamiccols", &dynamiccols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPgetBoolParam(scip, "reading/dynamicrows", &dynamicrows), TERMINATE );
+
+   /* the name block starts with the problem name, followed by the variable names and the constraint names */
+   name = names;
+   SCIP_CALL_TERMINATE( retcode, SCIPcreateProb(scip, name, NULL, NULL, NULL, NULL, NULL, NULL, NULL), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetObjsense(scip, (SCIP_OBJSENSE)header.objsense), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPaddOrigObjoffset(scip, header.objoffset), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocClearBufferArray(scip, &vars, nvars), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &consnames, nconss), TERMINATE );
+
+   for( i = 0; i < nvars + nconss; ++i )
+   {
+      name += strlen(name) + 1;
+      if( name >= names + header.namessize )
+      {
+         SCIPerrorMessage("snapshot file <%s> is corrupted\n", filename);
+         retcode = SCIP_READERROR;
+         goto TERMINATE;
+      }
+
+      if( i < nvars )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPcreateVarImpl(scip, &vars[i], name, valueFromFile(scip, lbs[i]),
+               valueFromFile(scip, ubs[i]), objs[i], (SCIP_VARTYPE)vartypes[i], (SCIP_IMPLINTTYPE)impltypes[i],
+               !dynamiccols, dynamiccols, NULL, NULL, NULL, NULL, NULL), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPaddVar(scip, vars[i]), TERMINATE );
+      }
+      else
+         consnames[i - nvars] = name;
+   }
+
+   for( i = 0; i < nconss; ++i )
+   {
+      lhss[i] = valueFromFile(scip, lhss[i]);
+      rhss[i] = valueFromFile(scip, rhss[i]);
+   }
+
+   /* the variables of a row are gathered in a buffer, the coefficients can be passed on directly */
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &rowvars, maxrowlen), TERMINATE );
+
+   for( i = 0; i < nconss; ++i )
+   {
+      SCIP_CONS* cons;
+      int k;
+
+      for( k = beg[i]; k < beg[i + 1]; ++k )
+         rowvars[k - beg[i]] = vars[inds[k]];
+
+      SCIP_CALL_TERMINATE( retcode, SCIPcreateConsLinear(scip, &cons, consnames[i], beg[i + 1] - beg[i], rowvars,
+            beg[i + 1] > beg[i] ? &vals[beg[i]] : NULL, lhss[i], rhss[i], initialconss, TRUE, TRUE, TRUE, TRUE, FALSE,
+            FALSE, dynamicconss, dynamicrows, FALSE), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPaddCons(scip, cons), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPreleaseCons(scip, &cons), TERMINATE );
+   }
+
+ TERMINATE:
+   if( vars != NULL )
+   {
+      for( i = nvars - 1; i >= 0; --i )
+      {
+         if( vars[i] != NULL )
+         {
+            SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+         }
+      }
+   }
+   SCIPfreeBufferArrayNull(scip, &rowvars);
+   SCIPfreeBufferArrayNull(scip, &consnames);
+   SCIPfreeBufferArrayNull(scip, &vars);
+   SCIPfreeBufferArrayNull(scip, &names);
+   SCIPfreeBufferArrayNull(scip, &impltypes);
+   SCIPfreeBufferArrayNull(scip, &vartypes);
+   SCIPfreeBufferArrayNull(scip, &inds);
+   SCIPfreeBufferArrayNull(scip, &beg);
+   SCIPfreeBufferArrayNull(scip, &vals);
+   SCIPfreeBufferArrayNull(scip, &rhss);
+   SCIPfreeBufferArrayNull(scip, &lhss);
+   SCIPfreeBufferArrayNull(scip, &objs);
+   SCIPfreeBufferArrayNull(scip, &ubs);
+   SCIPfreeBufferArrayNull(scip, &lbs);
+   SCIPfclose(fp);
+
+   return retcode;
+}
+
+/** computes the coefficients of a constraint in terms of the written variables and appends them to the matrix */
+static
+SCIP_RETCODE appendConsCoefs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HASHMAP*         varmap,             /**< map from written variables to their indices */
+   SCIP_VAR**            consvars,           /**< variables of the constraint */
+   SCIP_Real*            consvals,           /**< coefficients of the constraint */
+   int                   nconsvars,          /**< number of variables of the constraint */
+   SCIP_Bool             transformed,        /**< is the constraint a transformed one? */
+   SCIP_Real*            lhs,                /**< pointer to left hand side, will be adjusted by the constant */
+   SCIP_Real*            rhs,                /**< pointer to right hand side, will be adjusted by the constant */
+   int**                 inds,               /**< pointer to the column indices of the matrix */
+   SCIP_Real**           vals,               /**< pointer to the coefficients of the matrix */
+   int*                  nnonzeros,          /**< pointer to the number of nonzeros of the matrix */
+   int*                  nonzerossize        /**< pointer to the size of the arrays of the matrix */
+   )
+{
+   SCIP_VAR** activevars = NULL;
+   SCIP_Real* activevals = NULL;
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   SCIP_Real constant = 0.0;
+   int nactivevars;
+   int requiredsize;
+   int v;
+
+   nactivevars = nconsvars;
+   SCIP_CALL_TERMINATE( retcode, SCIPduplicateBufferArray(scip, &activevars, consvars, MAX(nactivevars, 1)), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPduplicateBufferArray(scip, &activevals, consvals, MAX(nactivevars, 1)), TERMINATE );
+
+   /* retransform the variables to the active variables of the written problem */
+   if( transformed )
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPgetProbvarLinearSum(scip, activevars, activevals, &nactivevars, nactivevars,
+            &constant, &requiredsize), TERMINATE );
+
+      if( requiredsize > nactivevars )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPreallocBufferArray(scip, &activevars, requiredsize), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPreallocBufferArray(scip, &activevals, requiredsize), TERMINATE );
+
+         SCIP_CALL_TERMINATE( retcode, SCIPgetProbvarLinearSum(scip, activevars, activevals, &nactivevars, requiredsize,
+               &constant, &requiredsize), TERMINATE );
+      }
+      assert(requiredsize == nactivevars);
+   }
+   else
+   {
+      for( v = 0; v < nactivevars; ++v )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPvarGetOrigvarSum(&activevars[v], &activevals[v], &constant), TERMINATE );
+
+         /* negated variables with an original counterpart may also be returned by SCIPvarGetOrigvarSum() */
+         if( SCIPvarGetStatus(activevars[v]) == SCIP_VARSTATUS_NEGATED )
+         {
+            activevars[v] = SCIPvarGetNegatedVar(activevars[v]);
+            constant += activevals[v];
+            activevals[v] *= -1.0;
+         }
+      }
+   }
+
+   if( !SCIPisInfinity(scip, -*lhs) )
+      *lhs -= constant;
+   if( !SCIPisInfinity(scip, *rhs) )
+      *rhs -= constant;
+
+   if( *nnonzeros + nactivevars > *nonzerossize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, *nnonzeros + nactivevars);
+      SCIP_CALL_TERMINATE( retcode, SCIPreallocBlockMemoryArray(scip, inds, *nonzerossize, newsize), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPreallocBlockMemoryArray(scip, vals, *nonzerossize, newsize), TERMINATE );
+      *nonzerossize = newsize;
+   }
+
+   for( v = 0; v < nactivevars; ++v )
+   {
+      if( activevals[v] == 0.0 ) /*lint !e777*/
+         continue;
+
+      if( !SCIPhashmapExists(varmap, (void*)activevars[v]) )
+      {
+         SCIPerrorMessage("variable <%s> is not a variable of the written problem\n", SCIPvarGetName(activevars[v]));
+         retcode = SCIP_WRITEERROR;
+         goto TERMINATE;
+      }
+
+      (*inds)[*nnonzeros] = SCIPhashmapGetImageInt(varmap, (void*)activevars[v]);
+      (*vals)[*nnonzeros] = activevals[v];
+      ++(*nnonzeros);
+   }
+
+TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &activevals);
+   SCIPfreeBufferArrayNull(scip, &activevars);
+
+   return retcode;
+}
+
+/** writes a problem in snp format */
+static
+SCIP_RETCODE writeSnp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< problem name */
+   SCIP_Bool             transformed,        /**< TRUE iff problem is the transformed problem */
+   SCIP_OBJSENSE         objsense,           /**< objective sense */
+   SCIP_Real             objoffset,          /**< objective offset from bound shifting and fixing */
+   SCIP_Real             objscale,           /**< scalar applied to objective function */
+   SCIP_VAR**            vars,               /**< array with active variables */
+   int                   nvars,              /**< number of active variables in the problem */
+   SCIP_CONS**           conss,              /**< array with constraints of the problem */
+   int                   nconss              /**< number of constraints in the problem */
+   )
+{
+   SNPHEADER header;
+   SCIP_HASHMAP* varmap;
+   SCIP_CONS** writtenconss;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real* objs;
+   SCIP_Real* lhss;
+   SCIP_Real* rhss;
+   SCIP_Real* vals = NULL;
+   int* beg;
+   int* inds = NULL;
+   char* vartypes;
+   char* impltypes;
+   SCIP_Longint namessize;
+   SCIP_Bool success;
+   int nonzerossize = 0;
+   int nnonzeros = 0;
+   int consvarssize;
+   int nwrittenconss;
+   int c;
+   int v;
+
+   assert(scip != NULL);
+   assert(file != NULL);
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &objs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vartypes, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &impltypes, nvars) );
+
+   namessize = (SCIP_Longint)strlen(name) + 1;
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*)vars[v], v) );
+
+      /* in the transformed problem, the local bounds are the ones valid at the current node */
+      lbs[v] = valueToFile(scip, transformed ? SCIPvarGetLbLocal(vars[v]) : SCIPvarGetLbOriginal(vars[v]));
+      ubs[v] = valueToFile(scip, transformed ? SCIPvarGetUbLocal(vars[v]) : SCIPvarGetUbOriginal(vars[v]));
+      objs[v] = objscale * SCIPvarGetObj(vars[v]);
+      vartypes[v] = (char)SCIPvarGetType(vars[v]);
+      impltypes[v] = (char)SCIPvarGetImplType(vars[v]);
+      namessize += (SCIP_Longint)strlen(SCIPvarGetName(vars[v])) + 1;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &writtenconss, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhss, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhss, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &beg, nconss + 1) );
+
+   consvarssize = 16;
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvars, consvarssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvals, consvarssize) );
+
+   /* collect the constraints that can be represented as a single linear constraint */
+   nwrittenconss = 0;
+   beg[0] = 0;
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+      int nconsvars;
+
+      /* check the type first, since the getters of the sides print their own warning for other constraints */
+      success = SCIPconsIsLinearRepresentable(conss[c]);
+      if( success )
+         rhs = SCIPconsGetRhs(scip, conss[c], &success);
+      if( success )
+         lhs = SCIPconsGetLhs(scip, conss[c], &success);
+      if( success )
+      {
+         SCIP_CALL( SCIPgetConsNVars(scip, conss[c], &nconsvars, &success) );
+      }
+      if( !success )
+      {
+         SCIPwarningMessage(scip, "constraint <%s> of type <%s> cannot be printed in requested format\n",
+            SCIPconsGetName(conss[c]), SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])));
+         continue;
+      }
+
+      if( nconsvars > consvarssize )
+      {
+         consvarssize = SCIPcalcMemGrowSize(scip, nconsvars);
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvars, consvarssize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, &consvals, consvarssize) );
+      }
+
+      SCIP_CALL( SCIPgetConsVars(scip, conss[c], consvars, consvarssize, &success) );
+      assert(success);
+      SCIP_CALL( SCIPgetConsVals(scip, conss[c], consvals, consvarssize, &success) );
+      assert(success);
+
+      SCIP_CALL( appendConsCoefs(scip, varmap, consvars, consvals, nconsvars, transformed, &lhs, &rhs, &inds, &vals,
+            &nnonzeros, &nonzerossize) );
+
+      writtenconss[nwrittenconss] = conss[c];
+      lhss[nwrittenconss] = valueToFile(scip, lhs);
+      rhss[nwrittenconss] = valueToFile(scip, rhs);
+      beg[++nwrittenconss] = nnonzeros;
+      namessize += (SCIP_Longint)strlen(SCIPconsGetName(conss[c])) + 1;
+   }
+
+   SCIPfreeBufferArray(scip, &consvals);
+   SCIPfreeBufferArray(scip, &consvars);
+
+   BMSclearMemory(&header);
+   SCIPbinaryInitHeader(&header.binary, SNP_MAGIC, SNP_VERSION);
+   header.objsense = (int)objsense;
+   header.nvars = nvars;
+   header.nconss = nwrittenconss;
+   header.nnonzeros = nnonzeros;
+   header.namessize = namessize;
+   header.objoffset = objscale * objoffset;
+
+   success = SCIPbinaryWriteArray(file, &header, sizeof(header), 1)
+      && SCIPbinaryWriteArray(file, lbs, sizeof(SCIP_Real), (size_t)nvars)
+      && SCIPbinaryWriteArray(file, ubs, sizeof(SCIP_Real), (size_t)nvars)
+      && SCIPbinaryWriteArray(file, objs, sizeof(SCIP_Real), (size_t)nvars)
+      && SCIPbinaryWriteArray(file, lhss, sizeof(SCIP_Real), (size_t)nwrittenconss)
+      && SCIPbinaryWriteArray(file, rhss, sizeof(SCIP_Real), (size_t)nwrittenconss)
+      && SCIPbinaryWriteArray(file, vals, sizeof(SCIP_Real), (size_t)nnonzeros)
+      && SCIPbinaryWriteArray(file, beg, sizeof(int), (size_t)nwrittenconss + 1)
+      && SCIPbinaryWriteArray(file, inds, sizeof(int), (size_t)nnonzeros)
+      && SCIPbinaryWriteArray(file, vartypes, sizeof(char), (size_t)nvars)
+      && SCIPbinaryWriteArray(file, impltypes, sizeof(char), (size_t)nvars);
+
+   /* the names are written one after the other and padded in the end */
+   success = success && SCIPbinaryWriteString(file, name);
+   for( v = 0; v < nvars && success; ++v )
+      success = SCIPbinaryWriteString(file, SCIPvarGetName(vars[v]));
+   for( c = 0; c < nwrittenconss && success; ++c )
+      success = SCIPbinaryWriteString(file, SCIPconsGetName(writtenconss[c]));
+   success = success && SCIPbinaryWritePadding(file, (size_t)namessize);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &vals, nonzerossize);
+   SCIPfreeBlockMemoryArrayNull(scip, &inds, nonzerossize);
+   SCIPfreeBufferArray(scip, &beg);
+   SCIPfreeBufferArray(scip, &rhss);
+   SCIPfreeBufferArray(scip, &lhss);
+   SCIPfreeBufferArray(scip, &writtenconss);
+   SCIPfreeBufferArray(scip, &impltypes);
+   SCIPfreeBufferArray(scip, &vartypes);
+   SCIPfreeBufferArray(scip, &objs);
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+   SCIPhashmapFree(&varmap);
+
+   if( !success )
+   {
+      SCIPerrorMessage("error while writing snapshot file\n");
+      return SCIP_WRITEERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopySnp)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(reader != NULL);
+
+   SCIP_STRINGEQ( SCIPreaderGetName(reader), READER_NAME, SCIP_INVALIDCALL );
+
+   /* call inclusion method of reader */
+   SCIP_CALL( SCIPincludeReaderSnp(scip) );
+
+   return SCIP_OKAY;
+}
+
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadSnp)
+{  /*lint --e{715}*/
+   SCIP_RETCODE retcode;
+
+   assert(reader != NULL);
+   assert(result != NULL);
+
+   SCIP_STRINGEQ( SCIPreaderGetName(reader), READER_NAME, SCIP_INVALIDCALL );
+
+   if( SCIPisExact(scip) )
+   {
+      SCIPerrorMessage("snapshot reader cannot read problems in exact solving mode\n");
+      return SCIP_READERROR;
+   }
+
+   retcode = readSnp(scip, filename);
+
+   if( retcode == SCIP_NOFILE || retcode == SCIP_READERROR )
+      return retcode;
+
+   SCIP_CALL( retcode );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/** problem writing method of reader */
+static
+SCIP_DECL_READERWRITE(readerWriteSnp)
+{  /*lint --e{715}*/
+   assert(reader != NULL);
+   assert(result != NULL);
+
+   SCIP_STRINGEQ( SCIPreaderGetName(reader), READER_NAME, SCIP_INVALIDCALL );
+
+   if( SCIPisExact(scip) )
+   {
+      SCIPerrorMessage("snapshot reader cannot write problems in exact solving mode\n");
+      return SCIP_WRITEERROR;
+   }
+
+   SCIP_CALL( writeSnp(scip, file != NULL ? file : stdout, name, transformed, objsense, objoffset, objscale, vars, nvars,
+         conss, nconss) );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * reader specific interface methods
+ */
+
+/** includes the snp file reader in SCIP */
+SCIP_RETCODE SCIPincludeReaderSnp(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READER* reader;
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, NULL) );
+
+   assert(reader != NULL);
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopySnp) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadSnp) );
+   SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteSnp) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,76 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_snp.h
+ * @ingroup FILEREADERS
+ * @brief  SNP file reader and writer for binary snapshots of linear problems
+ *
+ * The SNP format stores a mixed-integer linear program in a compact binary form that can be loaded without any parsing.
+ * All data is kept in columnar arrays in the byte order of the machine that wrote the file:
+ *
+ * - a header of 48 bytes with the magic string "SCIPSNP", the format version, a byte order mark, the objective sense,
+ *   the number of variables, constraints, and nonzeros, the size of the name block, and the objective offset,
+ * - the lower bounds, upper bounds, and objective coefficients of the variables (doubles),
+ * - the left and right hand sides of the constraints (doubles),
+ * - the coefficients of the constraint matrix in compressed row format (doubles),
+ * - the row start positions and column indices of the constraint matrix (ints),
+ * - the variable types and implied integral types (chars),
+ * - the problem name, the variable names, and the constraint names as consecutive null-terminated strings.
+ *
+ * Every array starts at a multiple of 8 bytes, so that an uncompressed file can also be memory mapped directly. Infinite
+ * values are stored as plus or minus the largest double, see SCIP_REAL_MAX, and all values whose absolute value is at
+ * least the infinity value of the reading SCIP are mapped to its infinity.
+ *
+ * The writer supports all constraints that can be represented as a single linear constraint, see SCIPconsGetLhs(),
+ * and can write the original as well as the transformed problem, such that a presolved problem can be reloaded without
+ * presolving again. Files written on machines of different byte order cannot be read.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_READER_SNP_H__
+#define __SCIP_READER_SNP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** includes the snp file reader into SCIP
+ *
+ *  @ingroup FileReaderIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeReaderSnp(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -2163,6 +2163,33 @@ SCIP_Real SCIPgetRowObjParallelism(
    return SCIProwGetObjParallelism(row, scip->set, scip->lp);
 }
 
+/** computes the parallelism of a row with each row of the given array, as returned by SCIProwGetParallelism() with
+ *  orthofunc 'e'; this is faster than calling SCIProwGetParallelism() for each pair of rows, because the coefficients of
+ *  the first row are only scattered once
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre this method can be called in one of the following stages of the SCIP solving process:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPgetRowParallelisms(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROW*             row,                /**< LP row */
+   SCIP_ROW**            rows,               /**< LP rows to compute the parallelism with */
+   int                   nrows,              /**< number of rows in the array */
+   SCIP_Real*            parallelisms        /**< array to store the parallelisms of the rows */
+   )
+{
+   assert(row != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetRowParallelisms", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIProwGetParallelisms(row, rows, nrows, scip->set, scip->stat, parallelisms) );
+
+   return SCIP_OKAY;
+}
+
 /** output row to file stream via the message handler system
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -55,6 +55,7 @@
 #include "scip/disp.h"
 #include "scip/history.h"
 #include "scip/implics.h"
+#include "scip/lp.h"
 #include "scip/pricestore.h"
 #include "scip/primal.h"
 #include "scip/prob.h"
@@ -4563,6 +4564,11 @@ void SCIPprintLPStatistics(
    else
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "          -\n");
 
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "LP solver changes  :      Calls Calls/node\n");
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  flushed          : %10" SCIP_LONGINT_FORMAT " %10.2f\n",
+      SCIPlpGetNFlushLPICalls(scip->lp),
+      scip->stat->ntotalnodes > 0 ? (SCIP_Real)SCIPlpGetNFlushLPICalls(scip->lp)/(SCIP_Real)scip->stat->ntotalnodes : 0.0);
+
    if( scip->set->exact_enable )
    {
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "Safe Bounding      :       Time      Calls Iterations  Iter/call   Iter/sec     Nfails   AvgError   NObjlim  NObjlimF \n");
@@ -4638,6 +4644,7 @@ SCIP_RETCODE SCIPcollectLPStatistics(
    SCIP_DATATREE* strongbranch;
    SCIP_DATATREE* strongbranchroot;
    SCIP_DATATREE* conflict;
+   SCIP_DATATREE* flush;
 
    assert(scip != NULL);
    assert(scip->stat != NULL);
@@ -4740,6 +4747,14 @@ SCIP_RETCODE SCIPcollectLPStatistics(
       SCIP_CALL( SCIPinsertDatatreeReal(scip, conflict, "iter_per_time", (SCIP_Real)scip->stat->nconflictlpiterations / SCIPclockGetTime(scip->stat->conflictlptime)) );
    }
 
+   /* LP solver changes statistics */
+   SCIP_CALL( SCIPcreateDatatreeInTree(scip, datatree, &flush, "lp_flush", 2) );
+   SCIP_CALL( SCIPinsertDatatreeLong(scip, flush, "calls", SCIPlpGetNFlushLPICalls(scip->lp)) );
+   if( scip->stat->ntotalnodes > 0 )
+   {
+      SCIP_CALL( SCIPinsertDatatreeReal(scip, flush, "calls_per_node", (SCIP_Real)SCIPlpGetNFlushLPICalls(scip->lp) / scip->stat->ntotalnodes) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -98,6 +98,7 @@ SCIP_RETCODE SCIPincludeDefaultPlugins(
    SCIP_CALL( SCIPincludeReaderCnf(scip) );
    SCIP_CALL( SCIPincludeReaderCip(scip) );
    SCIP_CALL( SCIPincludeReaderSmps(scip) );
+   SCIP_CALL( SCIPincludeReaderSnp(scip) );
    SCIP_CALL( SCIPincludeReaderSto(scip) );
    SCIP_CALL( SCIPincludeReaderTim(scip) );
    SCIP_CALL( SCIPincludeReaderCor(scip) );
@@ -116,6 +117,7 @@ SCIP_RETCODE SCIPincludeDefaultPlugins(
 #endif
    SCIP_CALL( SCIPincludePresolTrivial(scip) );
    SCIP_CALL( SCIPincludePresolBoundshift(scip) );
+   SCIP_CALL( SCIPincludePresolCache(scip) );
    SCIP_CALL( SCIPincludePresolInttobinary(scip) );
    SCIP_CALL( SCIPincludePresolConvertinttobin(scip) );
    SCIP_CALL( SCIPincludePresolGateextraction(scip) );
@@ -180,6 +180,7 @@
 #include "scip/nodesel_uct.h"
 #include "scip/nodesel_restartdfs.h"
 #include "scip/presol_boundshift.h"
+#include "scip/presol_cache.h"
 #include "scip/presol_convertinttobin.h"
 #include "scip/presol_domcol.h"
 #include "scip/presol_dualagg.h"
@@ -228,6 +229,7 @@
 #include "scip/reader_pbm.h"
 #include "scip/reader_rlp.h"
 #include "scip/reader_smps.h"
+#include "scip/reader_snp.h"
 #include "scip/reader_sol.h"
 #include "scip/reader_sto.h"
 #include "scip/reader_tim.h"
@@ -701,7 +701,12 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
       j = basisperm[i];
       c = basisind[j];
 
-      /* get the row of B^-1 for this basic integer variable with fractional solution value */
+      /* get the row of B^-1 for this basic integer variable with fractional solution value
+       *
+       * @todo get the rows of several fractional basic variables in one call once an LP interface offers a solve with
+       *       several right hand sides; none of the current ones does, and the factorization is already shared between
+       *       the calls for single rows
+       */
       SCIP_CALL( SCIPgetLPBInvRow(scip, j, binvrow, inds, &ninds) );
 
       SCIP_CALL( SCIPaggrRowSumRows(scip, aggrrow, binvrow, inds, ninds,
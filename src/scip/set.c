@@ -293,6 +293,8 @@
 #define SCIP_DEFAULT_LP_SOLUTIONPOLISHING     3 /**< LP solution polishing method (0: disabled, 1: only root, 2: always, 3: auto) */
 #define SCIP_DEFAULT_LP_REFACTORINTERVAL      0 /**< LP refactorization interval (0: automatic) */
 #define SCIP_DEFAULT_LP_ALWAYSGETDUALS    FALSE /**< should the dual solution always be collected */
+#define SCIP_DEFAULT_LP_NORMCACHESIZE        32 /**< maximal number of forks whose LP pricing norms are kept to warm
+                                                 *   start the LP after a node switch (0: disable) */
 
 /* NLP */
 
@@ -465,6 +467,8 @@
 #define SCIP_DEFAULT_SEPA_CUTSELRESTART     'a' /**< cut selection during restart ('a'ge, activity 'q'uotient) */
 #define SCIP_DEFAULT_SEPA_CUTSELSUBSCIP     'a' /**< cut selection for sub SCIPs  ('a'ge, activity 'q'uotient) */
 #define SCIP_DEFAULT_SEPA_FILTERCUTPOOLREL FALSE /**< should cutpool separate only cuts with high relative efficacy? */
+#define SCIP_DEFAULT_SEPA_COMPACTCUTPOOL FALSE /**< should cut pools compute the LP activities of their cuts from compact
+                                                 *   copies of the cuts and a dense copy of the LP solution? */
 #define SCIP_DEFAULT_SEPA_MAXRUNS            -1 /**< maximal number of runs for which separation is enabled (-1: unlimited) */
 #define SCIP_DEFAULT_SEPA_MAXROUNDS          -1 /**< maximal number of separation rounds per node (-1: unlimited) */
 #define SCIP_DEFAULT_SEPA_MAXROUNDSROOT      -1 /**< maximal number of separation rounds in the root node (-1: unlimited) */
@@ -482,6 +486,9 @@
 #define SCIP_DEFAULT_SEPA_CUTAGELIMIT        80 /**< maximum age a cut can reach before it is deleted from global cut pool
                                                  *   (-1: cuts are never deleted from the global cut pool) */
 #define SCIP_DEFAULT_SEPA_POOLFREQ           10 /**< separation frequency for the global cut pool */
+#define SCIP_DEFAULT_SEPA_NEGPRIOFREQ         1 /**< frequency of separation rounds in which separators with negative
+                                                 *   priority are called although cuts were already found in the round
+                                                 *   (0: only if no cuts were found) */
 #define SCIP_DEFAULT_SEPA_MINACTIVITYQUOT   0.8 /**< minimum cut activity quotient to convert cuts into constraints
                                                  *   during a restart (0.0: all cuts are converted) */
 
@@ -2143,6 +2150,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should the Farkas duals always be collected when an LP is found to be infeasible?",
          &(*set)->lp_alwaysgetduals, FALSE, SCIP_DEFAULT_LP_ALWAYSGETDUALS,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "lp/normcachesize",
+         "maximal number of forks whose LP pricing norms are kept to warm start the LP after a node switch (0: disable)",
+         &(*set)->lp_normcachesize, TRUE, SCIP_DEFAULT_LP_NORMCACHESIZE, 0, INT_MAX,
+         NULL, NULL) );
 
    /* NLP parameters */
    SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
@@ -2732,6 +2744,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should cutpool separate only cuts with high relative efficacy?",
          &(*set)->sepa_filtercutpoolrel, TRUE, SCIP_DEFAULT_SEPA_FILTERCUTPOOLREL,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "separating/compactcutpool",
+         "should cut pools compute the LP activities of their cuts from compact copies of the cuts and a dense copy of the LP solution (needs additional memory, activities may differ in the last bits)?",
+         &(*set)->sepa_compactcutpool, TRUE, SCIP_DEFAULT_SEPA_COMPACTCUTPOOL,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "separating/maxruns",
          "maximal number of runs for which separation is enabled (-1: unlimited)",
@@ -2787,6 +2804,11 @@ SCIP_RETCODE SCIPsetCreate(
          "separation frequency for the global cut pool (-1: disable global cut pool, 0: only separate pool at the root)",
          &(*set)->sepa_poolfreq, FALSE, SCIP_DEFAULT_SEPA_POOLFREQ, -1, SCIP_MAXTREEDEPTH,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "separating/negpriofreq",
+         "frequency of separation rounds in which separators with negative priority are called although cuts were already found in the round (0: only if no cuts were found)",
+         &(*set)->sepa_negpriofreq, TRUE, SCIP_DEFAULT_SEPA_NEGPRIOFREQ, 0, INT_MAX,
+         NULL, NULL) );
 
    /* parallel parameters */
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
@@ -2922,6 +2922,18 @@ SCIP_RETCODE separationRoundLP(
    while( j < set->nsymhdlrs && SCIPsymhdlrSepaGetPriority(set->symhdlrs_sepa[j]) >= 0 )
       ++j;
 
+   /* separators with negative priority are usually expensive: if cuts were already found in this round, call them only
+    * in every negpriofreq-th separation round, such that the LP is resolved with the cheaper cuts in between; this
+    * applies to the separators of symmetry handlers as well
+    */
+   if( !onlydelayed && SCIPsepastoreGetNCuts(sepastore) > 0 && set->sepa_negpriofreq != 1
+      && (set->sepa_negpriofreq == 0 || stat->nseparounds % set->sepa_negpriofreq != 0) )
+   {
+      SCIPsetDebugMsg(set, " -> skipping separators with negative priority in separation round %d\n", stat->nseparounds);
+      i = set->nsepas;
+      j = set->nsymhdlrs;
+   }
+
    /* execute separators with negative priority */
    while( (i < set->nsepas || j < set->nsymhdlrs) && !(*cutoff) && !(*lperror)
            && !(*enoughcuts) && lp->flushed && lp->solved
@@ -247,6 +247,9 @@ SCIP_RETCODE SCIPstatUpdateVarRootLPBestEstimate(
       case offsetof(SCIP_STAT, ndualresolvelpiterations): \
          SCIPupdateDeterministicTimeCount(stat, set, 0.00531625104146 * ((val) - (stat)->field) * (stat)->nnz ); \
          break; \
+      case offsetof(SCIP_STAT, nsblpiterations): \
+         SCIPupdateDeterministicTimeCount(stat, set, 0.00531625104146 * ((val) - (stat)->field) * (stat)->nnz ); \
+         break; \
       case offsetof(SCIP_STAT, nprobboundchgs): \
          SCIPupdateDeterministicTimeCount(stat, set, 0.000738719124051 * ((val) - (stat)->field) * (stat)->nnz ); \
          break; \
@@ -268,6 +271,9 @@ SCIP_RETCODE SCIPstatUpdateVarRootLPBestEstimate(
       case offsetof(SCIP_STAT, ndualresolvelpiterations): \
          SCIPupdateDeterministicTimeCount(stat, set, 0.00531625104146 * (stat)->nnz ); \
          break; \
+      case offsetof(SCIP_STAT, nsblpiterations): \
+         SCIPupdateDeterministicTimeCount(stat, set, 0.00531625104146 * (stat)->nnz ); \
+         break; \
       case offsetof(SCIP_STAT, nprobboundchgs): \
          SCIPupdateDeterministicTimeCount(stat, set, 0.000738719124051 * (stat)->nnz ); \
          break; \
@@ -288,6 +294,9 @@ SCIP_RETCODE SCIPstatUpdateVarRootLPBestEstimate(
       case offsetof(SCIP_STAT, ndualresolvelpiterations): \
          SCIPupdateDeterministicTimeCount(stat, set, 0.00531625104146 * (val) * (stat)->nnz); \
          break; \
+      case offsetof(SCIP_STAT, nsblpiterations): \
+         SCIPupdateDeterministicTimeCount(stat, set, 0.00531625104146 * (val) * (stat)->nnz); \
+         break; \
       case offsetof(SCIP_STAT, nprobboundchgs): \
          SCIPupdateDeterministicTimeCount(stat, set, 0.000738719124051 * (val) * (stat)->nnz ); \
          break; \
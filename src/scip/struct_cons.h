@@ -278,6 +278,7 @@ struct SCIP_Conshdlr
    SCIP_Bool             delaysepa;          /**< should separation method be delayed, if other separators found cuts? */
    SCIP_Bool             delayprop;          /**< should propagation method be delayed, if other propagators found reductions? */
    SCIP_Bool             needscons;          /**< should the constraint handler be skipped, if no constraints are available? */
+   SCIP_Bool             propmarkedonly;     /**< does the propagation method only process constraints marked for propagation? */
    SCIP_Bool             sepalpwasdelayed;   /**< was the LP separation method delayed at the last call? */
    SCIP_Bool             sepasolwasdelayed;  /**< was the SOL separation method delayed at the last call? */
    SCIP_Bool             propwasdelayed;     /**< was the propagation method delayed at the last call? */
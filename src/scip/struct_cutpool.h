@@ -48,10 +48,18 @@ extern "C" {
 struct SCIP_Cut
 {
    SCIP_ROW*             row;                /**< LP row of this cut */
+   int*                  colinds;            /**< column indices of the row's nonzeros, see SCIPcolGetIndex(), or NULL */
+   SCIP_Real*            colvals;            /**< coefficients of the row's nonzeros, or NULL */
+   int*                  colcutpos;          /**< positions of the cut in the occurrence lists of its columns, or NULL */
+   SCIP_Real             lpactivity;         /**< activity of the row for the LP solution values stored in the pool */
    SCIP_Longint          processedlp;        /**< last LP, where this cut was processed in separation of the LP solution */
    SCIP_Longint          processedlpsol;     /**< last LP, where this cut was processed in separation of other solutions */
    int                   age;                /**< age of the cut: number of successive times, the cut was not violated */
    int                   pos;                /**< position of cut in the cuts array of the cut pool */
+   int                   len;                /**< number of nonzeros in colinds and colvals */
+   SCIP_Bool             hascopy;            /**< does the cut store a copy of its row's nonzeros and is it linked to the
+                                              *   occurrence lists of the pool? */
+   SCIP_Bool             validlpactivity;    /**< is lpactivity valid for the LP solution values stored in the pool? */
 };
 
 /** storage for pooled cuts */
@@ -64,11 +72,22 @@ struct SCIP_Cutpool
    SCIP_CLOCK*           poolclock;          /**< separation time */
    SCIP_HASHTABLE*       hashtable;          /**< hash table to identify already stored cuts */
    SCIP_CUT**            cuts;               /**< stored cuts of the pool */
+   SCIP_Real*            lpsolvals;          /**< LP solution values of the columns, indexed by column index */
+   SCIP_Real*            newlpsolvals;       /**< buffer to collect the values of the next LP solution in */
+   SCIP_CUT***           colcuts;            /**< occurrence lists: cuts containing each column, indexed by column index */
+   int**                 colcutnzs;          /**< positions of the column in the nonzeros of the cuts in colcuts */
+   int*                  ncolcuts;           /**< number of cuts in the occurrence list of each column */
+   int*                  colcutssizes;       /**< sizes of the occurrence lists of the columns */
    SCIP_Longint          processedlp;        /**< last LP that has been processed for separating the LP */
    SCIP_Longint          processedlpsol;     /**< last LP that has been processed for separating other solutions */
    SCIP_Real             processedlpefficacy;/**< minimal efficacy used in last processed LP */
    SCIP_Real             processedlpsolefficacy;/**< minimal efficacy used in last processed LP for separating other solutions */
+   SCIP_Longint          lpsolvalslp;        /**< LP for which the values in lpsolvals are valid, or -1 */
+   SCIP_Longint          nnonzeros;          /**< total number of nonzeros of the cuts stored in the pool */
    int                   cutssize;           /**< size of cuts array */
+   int                   lpsolvalssize;      /**< size of lpsolvals and newlpsolvals arrays */
+   int                   nlpsolvals;         /**< number of columns for which lpsolvals is valid */
+   int                   colcutssize;        /**< size of the arrays indexed by column index for the occurrence lists */
    int                   ncuts;              /**< number of cuts stored in the pool */
    int                   nremovablecuts;     /**< number of cuts stored in the pool that are marked to be removable */
    int                   agelimit;           /**< maximum age a cut can reach before it is deleted from the pool */
@@ -90,7 +90,9 @@ struct SCIP_CliqueList
 {
    SCIP_CLIQUE**         cliques[2];         /**< cliques the variable fixed to FALSE/TRUE is member of */
    int                   ncliques[2];        /**< number of cliques the variable fixed to FALSE/TRUE is member of */
-   int                   size[2];            /**< size of cliques arrays */
+   int                   size[2];            /**< size of cliques and ids arrays */
+   unsigned int*         ids[2];             /**< ids of the cliques in the cliques arrays, stored contiguously such that
+                                              *   searches and intersections do not need to dereference the cliques */
 };
 
 /** collection of cliques */
@@ -319,6 +319,7 @@ struct SCIP_Lp
    SCIP_Longint          validsoldirlp;      /**< LP number for which the currently stored solution direction vector is valid */
    SCIP_Longint          validdegeneracylp;  /**< LP number for which the currently stored degeneracy information is valid */
    SCIP_Longint          divenolddomchgs;    /**< number of domain changes before diving has started */
+   SCIP_Longint          nflushlpicalls;     /**< number of LP interface calls for applying cached changes to the LP solver */
    int                   lpicolssize;        /**< available slots in lpicols vector */
    int                   nlpicols;           /**< number of columns in the LP solver */
    int                   lpifirstchgcol;     /**< first column of the LP which differs from the column in the LP solver */
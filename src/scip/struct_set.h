@@ -412,6 +412,8 @@ struct SCIP_Set
    int                   lp_solutionpolishing;/**< LP solution polishing method (0: disabled, 1: only root, 2: always, 3: auto) */
    int                   lp_refactorinterval;/**< LP refactorization interval (0: automatic) */
    SCIP_Bool             lp_alwaysgetduals;  /**< should the dual solution always be collected for LP solutions. */
+   int                   lp_normcachesize;   /**< maximal number of forks whose LP pricing norms are kept to warm start the LP
+                                              *   after a node switch (0: disable) */
 
    /* NLP settings */
    SCIP_Bool             nlp_disable;        /**< should the NLP be disabled even if a constraint handler enabled it? */
@@ -587,6 +589,8 @@ struct SCIP_Set
    char                  sepa_cutselrestart; /**< cut selection during restart ('a'ge, activity 'q'uotient) */
    char                  sepa_cutselsubscip; /**< cut selection for sub SCIPs  ('a'ge, activity 'q'uotient) */
    SCIP_Bool             sepa_filtercutpoolrel; /**< should cutpool separate only cuts with high relative efficacy? */
+   SCIP_Bool             sepa_compactcutpool; /**< should cut pools compute the LP activities of their cuts from compact
+                                               *   copies of the cuts and a dense copy of the LP solution? */
    int                   sepa_maxruns;       /**< maximal number of runs for which separation is enabled (-1: unlimited) */
    int                   sepa_maxrounds;     /**< maximal number of separation rounds per node (-1: unlimited) */
    int                   sepa_maxroundsroot; /**< maximal number of separation rounds in the root node (-1: unlimited) */
@@ -605,6 +609,8 @@ struct SCIP_Set
    int                   sepa_maxcutsroot;   /**< maximal number of separated cuts at the root node */
    int                   sepa_cutagelimit;   /**< maximum age a cut can reach before it is deleted from the global cut pool */
    int                   sepa_poolfreq;      /**< separation frequency for the global cut pool */
+   int                   sepa_negpriofreq;   /**< frequency of separation rounds in which separators with negative priority
+                                              *   are called although cuts were already found in the round */
 
    /* parallel settings */
    int                   parallel_mode;      /**< the mode for the parallel implementation. 0: opportunistic or
@@ -72,6 +72,10 @@ struct SCIP_SyncStore
    SCIP_Real             syncfreqmax;        /**< the maximum synchronization frequency */
    int                   maxnsols;           /**< maximum number of solutions that can be shared in one synchronization */
    int                   nsolvers;           /**< number of solvers synchronizing with this syncstore */
+   SCIP_Real*            incumbentvals;      /**< solution values of the best solution published between synchronizations */
+   SCIP_Real             incumbentobj;       /**< objective value of the published solution */
+   SCIP_Longint          nincumbents;        /**< number of times a better solution has been published */
+   int                   incumbentsource;    /**< the solverid of the solver that published the solution */
 };
 
 
@@ -214,6 +214,8 @@ struct SCIP_Tree
    SCIP_LPISTATE*        probinglpistate;    /**< LP state information before probing started */
    SCIP_LPISTATE*        focuslpistate;      /**< LP state information of focus node */
    SCIP_LPINORMS*        probinglpinorms;    /**< LP pricing norms information before probing started */
+   SCIP_NODE**           normcachenodes;     /**< forks with cached LP pricing norms, from least to most recently used */
+   SCIP_LPINORMS**       normcachenorms;     /**< LP pricing norms of the forks in the norm cache */
    SCIP_PENDINGBDCHG*    pendingbdchgs;      /**< array of pending bound changes, or NULL */
    SCIP_Real*            probdiverelaxsol;   /**< array with stored original relaxation solution during diving or probing */
    SCIP_Real             probinglpobjval;    /**< lp objective value before probing started */
@@ -222,6 +224,8 @@ struct SCIP_Tree
    SCIP_Longint          lastbranchparentid; /**< last node id/number of branching parent */
    int                   divebdchgsize[2];   /**< holds the two sizes of the dive bound change information */
    int                   ndivebdchanges[2];  /**< current number of stored dive bound changes for the next depth */
+   int                   normcachesize;      /**< available slots in norm cache arrays */
+   int                   nnormcache;         /**< number of forks in the norm cache */
    int                   pendingbdchgssize;  /**< size of pendingbdchgs array */
    int                   npendingbdchgs;     /**< number of pending bound changes */
    int                   childrensize;       /**< available slots in children vector */
@@ -179,6 +179,11 @@ SCIP_RETCODE SCIPsyncstoreInit(
       SCIP_CALL( SCIPtpiInitCondition(&(syncstore->syncdata[i].allsynced)) );
    }
 
+   SCIP_CALL( SCIPallocBlockMemoryArray(syncstore->mainscip, &syncstore->incumbentvals, syncstore->ninitvars) );
+   syncstore->incumbentobj = SCIPinfinity(scip);
+   syncstore->nincumbents = 0;
+   syncstore->incumbentsource = -1;
+
    syncstore->initialized = TRUE;
    syncstore->stopped = FALSE;
 
@@ -230,6 +235,7 @@ SCIP_RETCODE SCIPsyncstoreExit(
    }
 
    SCIPfreeBlockMemoryArray(syncstore->mainscip, &syncstore->syncdata, syncstore->nsyncdata);
+   SCIPfreeBlockMemoryArray(syncstore->mainscip, &syncstore->incumbentvals, syncstore->ninitvars);
 
    syncstore->initialized = FALSE;
    syncstore->stopped = FALSE;
@@ -795,6 +801,109 @@ void SCIPsyncdataGetSolutionBuffer(
    }
 }
 
+/** publishes a solution to all other solvers without waiting for the next synchronization, if it is better than
+ *  the solution that was published last
+ *
+ *  In contrast to the synchronization data, the published solution is read by the other solvers at arbitrary points
+ *  of their solving process, so this must only be used in opportunistic mode.
+ */
+SCIP_RETCODE SCIPsyncstorePublishSolution(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_Real             solobj,             /**< the objective value of the solution multiplied by the objective sense,
+                                              *   so that smaller values are better */
+   int                   ownerid,            /**< an identifier for the owner of the solution, e.g. the thread number */
+   SCIP_Real*            solvals,            /**< the solution values */
+   int                   nvals,              /**< number of solution values */
+   SCIP_Bool*            published           /**< pointer to store whether the solution replaced the published one */
+   )
+{
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+   assert(syncstore->mode == SCIP_PARA_OPPORTUNISTIC);
+   assert(solvals != NULL);
+   assert(0 <= nvals && nvals <= syncstore->ninitvars);
+   assert(published != NULL);
+
+   SCIP_CALL( SCIPtpiAcquireLock(syncstore->lock) );
+
+   *published = solobj < syncstore->incumbentobj;
+
+   if( *published )
+   {
+      BMScopyMemoryArray(syncstore->incumbentvals, solvals, nvals);
+      syncstore->incumbentobj = solobj;
+      syncstore->incumbentsource = ownerid;
+      ++syncstore->nincumbents;
+   }
+
+   SCIP_CALL( SCIPtpiReleaseLock(syncstore->lock) );
+
+   return SCIP_OKAY;
+}
+
+/** returns the number of times a better solution has been published
+ *
+ *  This is meant as a cheap check whether SCIPsyncstoreGetPublishedSolution() needs to be called, which avoids copying
+ *  the solution values if no new solution has been published.
+ */
+SCIP_Longint SCIPsyncstoreGetNPublishedSolutions(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   SCIP_Longint nincumbents;
+
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(syncstore->lock) );
+
+   nincumbents = syncstore->nincumbents;
+
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(syncstore->lock) );
+
+   return nincumbents;
+}
+
+/** copies the published solution into the given array, if it has been published after the last call of the caller
+ *  and by another solver
+ */
+SCIP_RETCODE SCIPsyncstoreGetPublishedSolution(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   ownerid,            /**< an identifier of the calling solver, e.g. the thread number */
+   SCIP_Longint*         lastread,           /**< pointer to the number of the published solution that was read last
+                                              *   by the caller, which is updated */
+   SCIP_Real*            solvals,            /**< array to store the solution values */
+   int                   nvals,              /**< number of solution values */
+   SCIP_Real*            solobj,             /**< pointer to store the objective value of the solution multiplied by the
+                                              *   objective sense */
+   SCIP_Bool*            found               /**< pointer to store whether a new solution was copied */
+   )
+{
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+   assert(lastread != NULL);
+   assert(solvals != NULL);
+   assert(0 <= nvals && nvals <= syncstore->ninitvars);
+   assert(solobj != NULL);
+   assert(found != NULL);
+
+   SCIP_CALL( SCIPtpiAcquireLock(syncstore->lock) );
+
+   *found = syncstore->nincumbents > *lastread && syncstore->incumbentsource != ownerid;
+
+   if( *found )
+   {
+      BMScopyMemoryArray(solvals, syncstore->incumbentvals, nvals);
+      *solobj = syncstore->incumbentobj;
+   }
+
+   *lastread = syncstore->nincumbents;
+
+   SCIP_CALL( SCIPtpiReleaseLock(syncstore->lock) );
+
+   return SCIP_OKAY;
+}
+
 /** adds bound changes to the synchronization data */
 SCIP_RETCODE SCIPsyncdataAddBoundChanges(
    SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
@@ -280,6 +280,49 @@ void SCIPsyncdataGetSolutionBuffer(
                                               *   if the buffer is not NULL */
    );
 
+/** publishes a solution to all other solvers without waiting for the next synchronization, if it is better than
+ *  the solution that was published last
+ *
+ *  In contrast to the synchronization data, the published solution is read by the other solvers at arbitrary points
+ *  of their solving process, so this must only be used in opportunistic mode.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstorePublishSolution(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_Real             solobj,             /**< the objective value of the solution multiplied by the objective sense,
+                                              *   so that smaller values are better */
+   int                   ownerid,            /**< an identifier for the owner of the solution, e.g. the thread number */
+   SCIP_Real*            solvals,            /**< the solution values */
+   int                   nvals,              /**< number of solution values */
+   SCIP_Bool*            published           /**< pointer to store whether the solution replaced the published one */
+   );
+
+/** returns the number of times a better solution has been published
+ *
+ *  This is meant as a cheap check whether SCIPsyncstoreGetPublishedSolution() needs to be called, which avoids copying
+ *  the solution values if no new solution has been published.
+ */
+SCIP_EXPORT
+SCIP_Longint SCIPsyncstoreGetNPublishedSolutions(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
+/** copies the published solution into the given array, if it has been published after the last call of the caller
+ *  and by another solver
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstoreGetPublishedSolution(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   ownerid,            /**< an identifier of the calling solver, e.g. the thread number */
+   SCIP_Longint*         lastread,           /**< pointer to the number of the published solution that was read last
+                                              *   by the caller, which is updated */
+   SCIP_Real*            solvals,            /**< array to store the solution values */
+   int                   nvals,              /**< number of solution values */
+   SCIP_Real*            solobj,             /**< pointer to store the objective value of the solution multiplied by the
+                                              *   objective sense */
+   SCIP_Bool*            found               /**< pointer to store whether a new solution was copied */
+   );
+
 /** adds bound changes to the synchronization data */
 SCIP_EXPORT
 SCIP_RETCODE SCIPsyncdataAddBoundChanges(
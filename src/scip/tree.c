@@ -147,6 +147,158 @@ SCIP_RETCODE treeEnsurePendingbdchgsMem(
    return SCIP_OKAY;
 }
 
+/** resizes norm cache arrays to be able to store at least num forks */
+static
+SCIP_RETCODE treeEnsureNormcacheMem(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of fork slots in norm cache */
+   )
+{
+   assert(tree != NULL);
+   assert(set != NULL);
+
+   if( num > tree->normcachesize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&tree->normcachenodes, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&tree->normcachenorms, newsize) );
+      tree->normcachesize = newsize;
+   }
+   assert(num <= tree->normcachesize);
+
+   return SCIP_OKAY;
+}
+
+/** frees the LP pricing norms at the given position of the norm cache and removes the fork from the cache */
+static
+SCIP_RETCODE treeNormcacheDelPos(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_LP*              lp,                 /**< current LP data */
+   int                   pos                 /**< position of the fork in the norm cache */
+   )
+{
+   assert(tree != NULL);
+   assert(0 <= pos && pos < tree->nnormcache);
+
+   SCIP_CALL( SCIPlpFreeNorms(lp, blkmem, &tree->normcachenorms[pos]) );
+
+   for( ; pos < tree->nnormcache - 1; ++pos )
+   {
+      tree->normcachenodes[pos] = tree->normcachenodes[pos + 1];
+      tree->normcachenorms[pos] = tree->normcachenorms[pos + 1];
+   }
+   --tree->nnormcache;
+
+   return SCIP_OKAY;
+}
+
+/** stores the LP pricing norms of the current LP for the given fork in the norm cache; if the cache is full, the norms
+ *  of the least recently used fork are discarded
+ */
+static
+SCIP_RETCODE treeNormcacheAdd(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_NODE*            node                /**< fork node whose LP was just solved */
+   )
+{
+   SCIP_LPINORMS* lpinorms;
+
+   assert(tree != NULL);
+   assert(set != NULL);
+   assert(node != NULL);
+   assert(SCIPnodeGetType(node) == SCIP_NODETYPE_FORK);
+
+   if( set->lp_normcachesize == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPlpGetNorms(lp, blkmem, &lpinorms) );
+
+   /* the LP solver might not provide pricing norms */
+   if( lpinorms == NULL )
+      return SCIP_OKAY;
+
+   /* the size of the cache might have been decreased since the last insertion */
+   while( tree->nnormcache >= set->lp_normcachesize )
+   {
+      SCIP_CALL( treeNormcacheDelPos(tree, blkmem, lp, 0) );
+   }
+
+   SCIP_CALL( treeEnsureNormcacheMem(tree, set, tree->nnormcache + 1) );
+   tree->normcachenodes[tree->nnormcache] = node;
+   tree->normcachenorms[tree->nnormcache] = lpinorms;
+   ++tree->nnormcache;
+
+   return SCIP_OKAY;
+}
+
+/** removes the given fork from the norm cache, if its LP pricing norms are stored */
+static
+SCIP_RETCODE treeNormcacheRemove(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_NODE*            node                /**< fork node */
+   )
+{
+   int i;
+
+   assert(tree != NULL);
+
+   for( i = tree->nnormcache - 1; i >= 0; --i )
+   {
+      if( tree->normcachenodes[i] == node )
+      {
+         SCIP_CALL( treeNormcacheDelPos(tree, blkmem, lp, i) );
+         break;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the cached LP pricing norms of the given fork, or NULL if they are not stored, and marks the fork as most
+ *  recently used
+ */
+static
+SCIP_LPINORMS* treeNormcacheUse(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_NODE*            node                /**< fork node */
+   )
+{
+   SCIP_LPINORMS* lpinorms;
+   int i;
+
+   assert(tree != NULL);
+
+   for( i = tree->nnormcache - 1; i >= 0; --i )
+   {
+      if( tree->normcachenodes[i] == node )
+         break;
+   }
+
+   if( i < 0 )
+      return NULL;
+
+   /* move the fork to the most recently used end of the cache */
+   lpinorms = tree->normcachenorms[i];
+   for( ; i < tree->nnormcache - 1; ++i )
+   {
+      tree->normcachenodes[i] = tree->normcachenodes[i + 1];
+      tree->normcachenorms[i] = tree->normcachenorms[i + 1];
+   }
+   tree->normcachenodes[i] = node;
+   tree->normcachenorms[i] = lpinorms;
+
+   return lpinorms;
+}
+
 
 
 
@@ -1215,6 +1367,7 @@ SCIP_RETCODE SCIPnodeFree(
             {
                SCIP_CALL( SCIPnodeReleaseLPIState(*node, blkmem, lp) );
             }
+            SCIP_CALL( treeNormcacheRemove(tree, blkmem, lp, *node) );
             SCIP_CALL( forkFree(&((*node)->data.fork), blkmem, set, lp) );
             break;
          case SCIP_NODETYPE_SUBROOT:
@@ -4255,6 +4408,7 @@ SCIP_RETCODE SCIPtreeLoadLPState(
    )
 {
    SCIP_NODE* lpstatefork;
+   SCIP_LPINORMS* lpinorms;
    SCIP_Bool updatefeas;
    SCIP_Bool checkbdchgs;
    int lpstateforkdepth;
@@ -4303,6 +4457,13 @@ SCIP_RETCODE SCIPtreeLoadLPState(
          SCIP_CALL( SCIPlpSetState(lp, blkmem, set, prob, eventqueue, lpstatefork->data.fork->lpistate,
                lpstatefork->data.fork->lpwasprimfeas, lpstatefork->data.fork->lpwasprimchecked,
                lpstatefork->data.fork->lpwasdualfeas, lpstatefork->data.fork->lpwasdualchecked) );
+
+         /* load the pricing norms of the fork's LP if they are still cached and the fork's basis was loaded */
+         lpinorms = treeNormcacheUse(tree, lpstatefork);
+         if( lpinorms != NULL && !lp->solved && lp->solisbasic )
+         {
+            SCIP_CALL( SCIPlpSetNorms(lp, blkmem, lpinorms) );
+         }
       }
       else
       {
@@ -4800,6 +4961,9 @@ SCIP_RETCODE focusnodeToFork(
    tree->focusnode->nodetype = SCIP_NODETYPE_FORK; /*lint !e641*/
    tree->focusnode->data.fork = fork;
 
+   /* keep the pricing norms of the fork's LP to warm start its children after a node switch */
+   SCIP_CALL( treeNormcacheAdd(tree, blkmem, set, lp, tree->focusnode) );
+
    /* capture the LPI state of the root node to ensure that the LPI state of the root stays for the whole solving
     * process
     */
@@ -5591,9 +5755,13 @@ SCIP_RETCODE SCIPtreeCreate(
    (*tree)->pathnlprows = NULL;
    (*tree)->probinglpistate = NULL;
    (*tree)->probinglpinorms = NULL;
+   (*tree)->normcachenodes = NULL;
+   (*tree)->normcachenorms = NULL;
    (*tree)->pendingbdchgs = NULL;
    (*tree)->probdiverelaxsol = NULL;
    (*tree)->nprobdiverelaxsol = 0;
+   (*tree)->normcachesize = 0;
+   (*tree)->nnormcache = 0;
    (*tree)->pendingbdchgssize = 0;
    (*tree)->npendingbdchgs = 0;
    (*tree)->focuslpstateforklpcount = -1;
@@ -5653,6 +5821,7 @@ SCIP_RETCODE SCIPtreeFree(
 
    /* free node queue */
    SCIP_CALL( SCIPnodepqFree(&(*tree)->leaves, blkmem, set, stat, eventqueue, eventfilter, *tree, lp) );
+   assert((*tree)->nnormcache == 0);
 
    /* free diving bound change storage */
    for( p = 0; p <= 1; ++p )
@@ -5672,6 +5841,8 @@ SCIP_RETCODE SCIPtreeFree(
    BMSfreeMemoryArrayNull(&(*tree)->pathnlprows);
    BMSfreeMemoryArrayNull(&(*tree)->probdiverelaxsol);
    BMSfreeMemoryArrayNull(&(*tree)->pendingbdchgs);
+   BMSfreeMemoryArrayNull(&(*tree)->normcachenorms);
+   BMSfreeMemoryArrayNull(&(*tree)->normcachenodes);
 
    BMSfreeMemory(tree);
 
@@ -5702,6 +5873,7 @@ SCIP_RETCODE SCIPtreeClear(
    /* clear node queue */
    SCIP_CALL( SCIPnodepqClear(tree->leaves, blkmem, set, stat, eventqueue, eventfilter, tree, lp) );
    assert(tree->root == NULL);
+   assert(tree->nnormcache == 0);
 
    /* we have to remove the captures of the variables within the pending bound change data structure */
    for( v = tree->npendingbdchgs-1; v >= 0; --v )
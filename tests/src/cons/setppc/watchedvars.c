@@ -0,0 +1,193 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   watchedvars.c
+ * @brief  tests that setppc constraints with watched variables give the same results as with counted fixings
+ */
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/cons_setppc.h"
+
+#include "include/scip_test.h"
+
+#define NVARS      40
+#define NSOLVARS    8
+#define NPARTROWS  16
+#define NPACKROWS   8
+#define NCOVERROWS  8
+#define ROWSIZE     6
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip = NULL;
+static unsigned int seed;
+
+/** returns a pseudo random number in {0, ..., n-1} */
+static
+int getRandomInt(
+   int                   n                   /**< number of possible values */
+   )
+{
+   seed = seed * 1103515245u + 12345u;
+
+   return (int)((seed >> 16) % (unsigned int)n);
+}
+
+/** creates a set partitioning / packing / covering constraint with the given planted variable and random variables that
+ *  are not part of the planted solution
+ */
+static
+void addSetppcCons(
+   SCIP_VAR**            vars,               /**< variables of the problem */
+   SCIP_SETPPCTYPE       type,               /**< type of the constraint */
+   int                   solvar,             /**< variable of the planted solution to add, or -1 */
+   int                   idx                 /**< index of the constraint, used for its name */
+   )
+{
+   SCIP_CONS* cons;
+   SCIP_VAR* consvars[ROWSIZE];
+   char name[SCIP_MAXSTRLEN];
+   int nconsvars = 0;
+   int i;
+
+   if( solvar >= 0 )
+      consvars[nconsvars++] = vars[solvar];
+
+   while( nconsvars < ROWSIZE )
+   {
+      SCIP_VAR* var;
+
+      var = vars[NSOLVARS + getRandomInt(NVARS - NSOLVARS)];
+
+      for( i = 0; i < nconsvars && consvars[i] != var; ++i )
+         ;
+      if( i == nconsvars )
+         consvars[nconsvars++] = var;
+   }
+
+   (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "c%d", idx);
+
+   switch( type )
+   {
+   case SCIP_SETPPCTYPE_PARTITIONING:
+      SCIP_CALL( SCIPcreateConsBasicSetpart(scip, &cons, name, nconsvars, consvars) );
+      break;
+   case SCIP_SETPPCTYPE_PACKING:
+      SCIP_CALL( SCIPcreateConsBasicSetpack(scip, &cons, name, nconsvars, consvars) );
+      break;
+   case SCIP_SETPPCTYPE_COVERING:
+   default:
+      SCIP_CALL( SCIPcreateConsBasicSetcover(scip, &cons, name, nconsvars, consvars) );
+      break;
+   }
+
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
+
+/** creates a feasible problem with set partitioning, packing and covering constraints, solves it, and returns the
+ *  optimal objective value
+ */
+static
+SCIP_Real solveSetppcProblem(
+   SCIP_Bool             watchedvars         /**< should fixings to zero only be caught for two watched variables? */
+   )
+{
+   SCIP_VAR* vars[NVARS];
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Real optimum;
+   int c = 0;
+   int v;
+   int i;
+
+   seed = 42;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "setppc") );
+
+   /* keep the constraints unchanged until the solving process, so that they are propagated with watched variables */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   /* solve by branching and propagation only, such that the problem is not decided by the LP at the root node */
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/setppc/watchedvars", watchedvars) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", v);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[v], name, 0.0, 1.0, (SCIP_Real)(1 + getRandomInt(20)),
+            SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[v]) );
+   }
+
+   /* the first NSOLVARS variables form a feasible solution: each partitioning and covering constraint contains exactly
+    * one of them, and each packing constraint at most one
+    */
+   for( i = 0; i < NPARTROWS; ++i )
+      addSetppcCons(vars, SCIP_SETPPCTYPE_PARTITIONING, i % NSOLVARS, c++);
+   for( i = 0; i < NPACKROWS; ++i )
+      addSetppcCons(vars, SCIP_SETPPCTYPE_PACKING, i % 2 == 0 ? -1 : i % NSOLVARS, c++);
+   for( i = 0; i < NCOVERROWS; ++i )
+      addSetppcCons(vars, SCIP_SETPPCTYPE_COVERING, (3 * i) % NSOLVARS, c++);
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   optimum = SCIPgetPrimalbound(scip);
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[v]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return optimum;
+}
+
+/** checks for memory leaks */
+static
+void teardown(void)
+{
+   cr_assert_null(scip);
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(watchedvars, .fini = teardown);
+
+/* TESTS */
+Test(watchedvars, sameoptimum, .description = "checks that watched variables do not change the optimum of a setppc problem")
+{
+   SCIP_Real optwatched;
+   SCIP_Real optcounted;
+
+   optwatched = solveSetppcProblem(TRUE);
+   optcounted = solveSetppcProblem(FALSE);
+
+   cr_assert_float_eq(optwatched, optcounted, 1e-6, "optimum with watched variables %g differs from %g",
+      optwatched, optcounted);
+}
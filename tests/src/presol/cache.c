@@ -0,0 +1,208 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cache.c
+ * @brief  unit tests for storing and reloading presolved problems
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "scip/presol_cache.c"
+
+#include "include/scip_test.h"
+
+#define NVARS 6
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip = NULL;
+static SCIP_VAR* vars[NVARS];
+static char filename[SCIP_MAXSTRLEN];
+static char directory[SCIP_MAXSTRLEN];
+
+/* TEST SUITE */
+
+/** creates a problem with a fixing, an equation on two variables, and a constraint that remains after presolving */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   SCIP_Real vals[NVARS] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+   char name[SCIP_MAXSTRLEN];
+   const char* tmpdir;
+   int v;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cache") );
+
+   /* write the cache files into a temporary directory below TMPDIR or the working directory, which is removed again
+    * in the teardown
+    */
+   tmpdir = getenv("TMPDIR");
+   if( tmpdir == NULL || *tmpdir == '\0' )
+      tmpdir = ".";
+   (void)SCIPsnprintf(directory, SCIP_MAXSTRLEN, "%s/scipcacheXXXXXX", tmpdir);
+   cr_assert_not_null(mkdtemp(directory), "could not create temporary directory");
+   SCIP_CALL( SCIPsetStringParam(scip, "presolving/cache/directory", directory) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", v);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[v], name, 0.0, 10.0, (SCIP_Real)(v + 1), SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[v]) );
+   }
+
+   /* x0 + x1 = 4 */
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "aggr", 2, vars, vals, 4.0, 4.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* x2 = 3 */
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "fix", 1, &vars[2], vals, 3.0, 3.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* 3 x3 + 5 x4 + 7 x5 = 50 */
+   vals[0] = 3.0;
+   vals[1] = 5.0;
+   vals[2] = 7.0;
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "sum", 3, &vars[3], vals, 50.0, 50.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   filename[0] = '\0';
+}
+
+/** frees the variables, SCIP, the cache file, and the temporary directory */
+static
+void teardown(void)
+{
+   int v;
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[v]) );
+   }
+
+   SCIPfree(&scip);
+
+   if( filename[0] != '\0' )
+      (void)remove(filename);
+
+   cr_assert_eq(rmdir(directory), 0, "temporary directory %s is not empty", directory);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(cache, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(cache, reload, .description = "checks that a presolved problem is written and reloaded with the same reductions")
+{
+   SCIP_PRESOLDATA* presoldata;
+   SCIP_SOL* sol;
+   SCIP_Real objoffset;
+   SCIP_Real solval;
+   int nvars;
+   int nconss;
+   int v;
+
+   presoldata = SCIPpresolGetData(SCIPfindPresol(scip, "cache"));
+   cr_assert_not_null(presoldata);
+
+   SCIP_CALL( SCIPpresolve(scip) );
+   cr_assert(presoldata->enabled);
+   cr_assert(presoldata->written);
+   cr_assert_not(presoldata->loaded);
+
+   getCacheFilename(presoldata, filename);
+
+   nvars = SCIPgetNVars(scip);
+   nconss = SCIPgetNConss(scip);
+   objoffset = SCIPgetTransObjoffset(scip);
+   cr_assert_lt(nvars, NVARS);
+
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   cr_assert(presoldata->loaded);
+   cr_assert_eq(SCIPgetNVars(scip), nvars);
+   cr_assert_leq(SCIPgetNConss(scip), nconss);
+   cr_assert(SCIPisEQ(scip, SCIPgetTransObjoffset(scip), objoffset));
+
+   /* a solution of the reloaded problem maps back to the original variables */
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+   for( v = 0; v < SCIPgetNVars(scip); ++v )
+   {
+      SCIP_CALL( SCIPsetSolVal(scip, sol, SCIPgetVars(scip)[v], SCIPvarGetLbGlobal(SCIPgetVars(scip)[v])) );
+   }
+
+   solval = SCIPgetSolVal(scip, sol, vars[2]);
+   cr_assert(SCIPisEQ(scip, solval, 3.0));
+   solval = SCIPgetSolVal(scip, sol, vars[0]) + SCIPgetSolVal(scip, sol, vars[1]);
+   cr_assert(SCIPisEQ(scip, solval, 4.0));
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+}
+
+Test(cache, parameters, .description = "checks that only relevant parameters change the hash value")
+{
+   SCIP_Bool success;
+   uint64_t hash;
+   uint64_t newhash;
+
+   SCIP_CALL( computeHash(scip, &hash, &success) );
+   cr_assert(success);
+
+   SCIP_CALL( SCIPsetRealParam(scip, "limits/time", 10.0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/rounding/freq", -1) );
+   SCIP_CALL( computeHash(scip, &newhash, &success) );
+   cr_assert(success);
+   cr_assert_eq(newhash, hash);
+
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 1) );
+   SCIP_CALL( computeHash(scip, &newhash, &success) );
+   cr_assert(success);
+   cr_assert_neq(newhash, hash);
+}
+
+Test(cache, unsupported, .description = "checks that problems with constraints that are not linear are not cached")
+{
+   SCIP_CONS* cons;
+   SCIP_Bool success;
+   uint64_t hash;
+
+   SCIP_CALL( SCIPcreateConsBasicSOS1(scip, &cons, "sos", 2, &vars[3], NULL) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( computeHash(scip, &hash, &success) );
+   cr_assert_not(success);
+}
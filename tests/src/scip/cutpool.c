@@ -0,0 +1,253 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cutpool.c
+ * @brief  tests that the LP activities computed by a cut pool agree with the activities of its rows
+ */
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS      30
+#define NKNAPSACKS  5
+#define NCUTS      20
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip = NULL;
+static SCIP_CUTPOOL* cutpool = NULL;
+static unsigned int seed;
+static int ncompared;
+static int ncreated;
+static SCIP_Bool replacecuts;
+
+/** returns a pseudo random number in {1, ..., n} */
+static
+int getRandomInt(
+   int                   n                   /**< maximal value */
+   )
+{
+   seed = seed * 1103515245u + 12345u;
+
+   return 1 + (int)((seed >> 16) % (unsigned int)n);
+}
+
+/** adds a dense row to the cut pool that is valid but never violated, such that it stays in the pool */
+static
+SCIP_RETCODE addPoolCut(
+   SCIP_SEPA*            sepa                /**< separator */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_ROW* row;
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Real coef;
+   SCIP_Real rhs;
+   int nvars;
+   int v;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "poolcut%d", ncreated++);
+   SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &row, sepa, name, -SCIPinfinity(scip), 0.0, FALSE, FALSE, TRUE) );
+   SCIP_CALL( SCIPcacheRowExtensions(scip, row) );
+
+   rhs = 0.0;
+   for( v = 0; v < nvars; ++v )
+   {
+      coef = getRandomInt(1000) / 7.0;
+      SCIP_CALL( SCIPaddVarToRow(scip, row, vars[v], coef) );
+      rhs += coef * SCIPvarGetUbGlobal(vars[v]);
+   }
+
+   SCIP_CALL( SCIPflushRowExtensions(scip, row) );
+   SCIP_CALL( SCIPchgRowRhs(scip, row, rhs + 1.0) );
+   SCIP_CALL( SCIPaddRowCutpool(scip, cutpool, row) );
+   SCIP_CALL( SCIPreleaseRow(scip, &row) );
+
+   return SCIP_OKAY;
+}
+
+/** separates the cut pool and compares the LP activities of its cuts with their activities in the LP solution */
+static
+SCIP_DECL_SEPAEXECLP(sepaExeclpTest)
+{
+   SCIP_CUT** cuts;
+   SCIP_SOL* sol;
+   SCIP_ROW* row;
+   SCIP_Real lpactivity;
+   SCIP_Real solactivity;
+   int ncuts;
+   int c;
+
+   *result = SCIP_DIDNOTRUN;
+
+   if( SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_OPTIMAL )
+      return SCIP_OKAY;
+
+   if( cutpool == NULL )
+   {
+      SCIP_CALL( SCIPcreateCutpool(scip, &cutpool, -1) );
+      for( c = 0; c < NCUTS; ++c )
+      {
+         SCIP_CALL( addPoolCut(sepa) );
+      }
+   }
+
+   SCIP_CALL( SCIPseparateCutpool(scip, cutpool, result) );
+
+   SCIP_CALL( SCIPcreateLPSol(scip, &sol, NULL) );
+
+   cuts = SCIPcutpoolGetCuts(cutpool);
+   ncuts = SCIPcutpoolGetNCuts(cutpool);
+   cr_assert_eq(ncuts, NCUTS);
+
+   for( c = 0; c < ncuts; ++c )
+   {
+      row = SCIPcutGetRow(cuts[c]);
+      lpactivity = SCIPgetRowLPActivity(scip, row);
+      solactivity = SCIPgetRowSolActivity(scip, row, sol);
+
+      cr_assert_float_eq(lpactivity, solactivity, 1e-9 * MAX(1.0, REALABS(solactivity)),
+         "LP activity %.15g of cut <%s> differs from its activity %.15g in the LP solution", lpactivity,
+         SCIProwGetName(row), solactivity);
+      ++ncompared;
+   }
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   /* replace the first cut, which moves the last cut of the pool and changes the occurrence lists of the columns */
+   if( replacecuts )
+   {
+      SCIP_CALL( SCIPdelRowCutpool(scip, cutpool, SCIPcutGetRow(cuts[0])) );
+      SCIP_CALL( addPoolCut(sepa) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the cut pool */
+static
+SCIP_DECL_SEPAEXITSOL(sepaExitsolTest)
+{
+   if( cutpool != NULL )
+   {
+      SCIP_CALL( SCIPfreeCutpool(scip, &cutpool) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates a multidimensional knapsack problem with a separator that checks its cut pool */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   SCIP_Longint weights[NVARS];
+   SCIP_CONS* cons;
+   SCIP_SEPA* sepa;
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Longint capacity;
+   int k;
+   int v;
+
+   seed = 42;
+   ncompared = 0;
+   ncreated = 0;
+   replacecuts = FALSE;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cutpool") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   SCIP_CALL( SCIPincludeSepaBasic(scip, &sepa, "test", "checks the activities of a cut pool", 0, 1, 1.0, FALSE, FALSE,
+         sepaExeclpTest, NULL, NULL) );
+   SCIP_CALL( SCIPsetSepaExitsol(scip, sepa, sepaExitsolTest) );
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "separating/compactcutpool", TRUE) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 100LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", v);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[v], name, 0.0, 1.0, (SCIP_Real)getRandomInt(100), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[v]) );
+   }
+
+   for( k = 0; k < NKNAPSACKS; ++k )
+   {
+      capacity = 0;
+      for( v = 0; v < NVARS; ++v )
+      {
+         weights[v] = getRandomInt(100);
+         capacity += weights[v];
+      }
+
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "knapsack%d", k);
+      SCIP_CALL( SCIPcreateConsBasicKnapsack(scip, &cons, name, NVARS, vars, weights, capacity / 3) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( v = 0; v < NVARS; ++v )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[v]) );
+   }
+}
+
+/** frees SCIP and checks for memory leaks */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_null(cutpool);
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(cutpool, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(cutpool, lpactivity, .description = "checks that the cut pool computes the same LP activities as the rows")
+{
+   SCIP_CALL( SCIPsolve(scip) );
+
+   /* the pool is separated in every node that solves its LP, hence in more than one LP solution */
+   cr_assert_gt(ncompared, NCUTS, "the cut pool was separated only %d times", ncompared / NCUTS);
+}
+
+Test(cutpool, replacecuts, .description = "checks the LP activities of the cut pool when cuts are deleted and added")
+{
+   replacecuts = TRUE;
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_gt(ncompared, NCUTS, "the cut pool was separated only %d times", ncompared / NCUTS);
+   cr_assert_gt(ncreated, NCUTS + 1);
+}
@@ -0,0 +1,176 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2026 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   parallelism.c
+ * @brief  tests that SCIPgetRowParallelisms() computes the same parallelisms as SCIProwGetParallelism()
+ */
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NLPVARS     8
+#define NNONLPVARS  4
+#define NLINCONSS   3
+#define NEXTRAROWS  4
+#define NROWS       (NLINCONSS + NEXTRAROWS)
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip = NULL;
+static SCIP_VAR* vars[NLPVARS + NNONLPVARS];
+static SCIP_ROW* extrarows[NEXTRAROWS];
+
+/** coefficient of a variable in a row; zero if the variable is not in the row */
+static
+SCIP_Real getCoef(
+   int                   row,                /**< index of the row */
+   int                   var                 /**< index of the variable */
+   )
+{
+   return (SCIP_Real)((3 * row + 5 * var) % 7 - 2);
+}
+
+/** creates a problem whose LP contains only part of the variables, constructs the LP, and creates rows that are not
+ *  in the LP
+ */
+static
+void setup(void)
+{
+   SCIP_VAR* origvars[NLPVARS + NNONLPVARS];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   SCIP_Bool cutoff;
+   int r;
+   int v;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "parallelism") );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   /* the columns of the first variables are in the initial LP, the ones of the others are not */
+   for( v = 0; v < NLPVARS + NNONLPVARS; ++v )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", v);
+      SCIP_CALL( SCIPcreateVar(scip, &origvars[v], name, -10.0, 10.0, 1.0, SCIP_VARTYPE_CONTINUOUS, v < NLPVARS,
+            v >= NLPVARS, NULL, NULL, NULL, NULL, NULL) );
+      SCIP_CALL( SCIPaddVar(scip, origvars[v]) );
+   }
+
+   /* the rows of the linear constraints are in the LP and also contain columns that are not in the LP */
+   for( r = 0; r < NLINCONSS; ++r )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "c%d", r);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, 0, NULL, NULL, -100.0, 100.0) );
+      for( v = 0; v < NLPVARS + NNONLPVARS; ++v )
+      {
+         if( getCoef(r, v) != 0.0 )
+         {
+            SCIP_CALL( SCIPaddCoefLinear(scip, cons, origvars[v], getCoef(r, v)) );
+         }
+      }
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+   SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+   cr_assert(!cutoff);
+   cr_assert_eq(SCIPgetNLPRows(scip), NLINCONSS);
+   cr_assert_eq(SCIPgetNLPCols(scip), NLPVARS);
+
+   for( v = 0; v < NLPVARS + NNONLPVARS; ++v )
+   {
+      SCIP_CALL( SCIPgetTransformedVar(scip, origvars[v], &vars[v]) );
+      SCIP_CALL( SCIPreleaseVar(scip, &origvars[v]) );
+   }
+
+   /* the extra rows are not in the LP, hence not linked to their columns; the last one only has non-LP columns */
+   for( r = 0; r < NEXTRAROWS; ++r )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "r%d", r);
+      SCIP_CALL( SCIPcreateEmptyRowUnspec(scip, &extrarows[r], name, -SCIPinfinity(scip), 1.0, FALSE, FALSE, TRUE) );
+      for( v = (r == NEXTRAROWS - 1 ? NLPVARS : 0); v < NLPVARS + NNONLPVARS; ++v )
+      {
+         if( getCoef(NLINCONSS + r, v) != 0.0 )
+         {
+            SCIP_CALL( SCIPaddVarToRow(scip, extrarows[r], vars[v], getCoef(NLINCONSS + r, v)) );
+         }
+      }
+   }
+}
+
+/** releases the rows, frees SCIP, and checks for memory leaks */
+static
+void teardown(void)
+{
+   int r;
+
+   for( r = 0; r < NEXTRAROWS; ++r )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &extrarows[r]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(parallelism, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(parallelism, samevalues, .description = "checks that parallelisms of rows in and not in the LP agree with SCIProwGetParallelism()")
+{
+   SCIP_ROW* rows[NROWS];
+   SCIP_Real parallelisms[NROWS];
+   SCIP_Real expected;
+   int r;
+   int s;
+
+   for( r = 0; r < NLINCONSS; ++r )
+      rows[r] = SCIPgetLPRows(scip)[r];
+   for( r = 0; r < NEXTRAROWS; ++r )
+      rows[NLINCONSS + r] = extrarows[r];
+
+   for( r = 0; r < NROWS; ++r )
+   {
+      SCIP_CALL( SCIPgetRowParallelisms(scip, rows[r], rows, NROWS, parallelisms) );
+
+      for( s = 0; s < NROWS; ++s )
+      {
+         expected = SCIProwGetParallelism(rows[r], rows[s], 'e');
+
+         cr_assert_float_eq(parallelisms[s], expected, 1e-12, "parallelism of <%s> and <%s> is %.15g instead of %.15g",
+            SCIProwGetName(rows[r]), SCIProwGetName(rows[s]), parallelisms[s], expected);
+
+      }
+
+      /* only columns in the LP contribute: every row with an LP column is parallel to itself, and the row without
+       * LP columns has zero parallelism with every row
+       */
+      cr_assert_float_eq(parallelisms[r], r == NROWS - 1 ? 0.0 : 1.0, 1e-12);
+      cr_assert_float_eq(parallelisms[NROWS - 1], 0.0, 1e-12);
+   }
+}